@@ -47,6 +47,93 @@ static int dyn_is_auth_disabled(void)
 }
 #endif /* TRUSTED_BOARD_BOOT */
 
+#if TRUSTED_BOARD_BOOT
+/*
+ * Optional streaming hash: when plat_load_hash_start() accepts an image, it
+ * is read in chunks and each chunk is passed to plat_load_hash_update()
+ * while the next one is being read, so the platform can have the image
+ * hash ready by the time loading completes.
+ */
+#ifndef LOAD_IMAGE_HASH_CHUNK_SIZE
+#define LOAD_IMAGE_HASH_CHUNK_SIZE	(16U * 1024U)
+#endif
+
+#pragma weak plat_load_hash_start
+int plat_load_hash_start(unsigned int image_id, uintptr_t dev_handle,
+			 uintptr_t image_base, size_t image_size)
+{
+	return -ENOTSUP;
+}
+
+#pragma weak plat_load_hash_update
+void plat_load_hash_update(uintptr_t data, size_t len)
+{
+}
+
+#pragma weak plat_load_hash_finish
+void plat_load_hash_finish(int result)
+{
+}
+
+/* Wait for the outstanding read on a handle */
+static int read_wait(uintptr_t image_handle, size_t *bytes_read)
+{
+	int io_result;
+
+	do {
+		io_result = io_read_poll(image_handle, bytes_read);
+	} while (io_result == -EINPROGRESS);
+
+	return io_result;
+}
+
+/*
+ * Read an image in chunks, hashing each chunk while the next one is read.
+ */
+static int load_image_hashed(uintptr_t image_handle, uintptr_t image_base,
+			     size_t image_size)
+{
+	size_t offset = 0U;
+	size_t chunk, next = 0U;
+	size_t bytes_read;
+	int io_result;
+
+	chunk = MIN(image_size, (size_t)LOAD_IMAGE_HASH_CHUNK_SIZE);
+	io_result = io_read_async(image_handle, image_base, chunk);
+
+	while (io_result == 0) {
+		io_result = read_wait(image_handle, &bytes_read);
+		if ((io_result == 0) && (bytes_read < chunk)) {
+			io_result = -EIO;
+		}
+		if (io_result != 0) {
+			break;
+		}
+
+		/* Start reading the next chunk, then hash this one */
+		if ((offset + chunk) < image_size) {
+			next = MIN(image_size - offset - chunk,
+				   (size_t)LOAD_IMAGE_HASH_CHUNK_SIZE);
+			io_result = io_read_async(image_handle,
+						  image_base + offset + chunk,
+						  next);
+		}
+
+		plat_load_hash_update(image_base + offset, chunk);
+		offset += chunk;
+
+		if ((io_result != 0) || (offset == image_size)) {
+			break;
+		}
+		chunk = next;
+	}
+
+	plat_load_hash_finish(io_result);
+
+	return io_result;
+}
+#endif /* TRUSTED_BOARD_BOOT */
+
 uintptr_t page_align(uintptr_t value, unsigned dir)
 {
 	/* Round up the limit to the next page boundary */
@@ -122,11 +209,27 @@ static int load_image(unsigned int image_id, image_info_t *image_data)
 	image_data->image_size = (uint32_t)image_size;
 
 	/* We have enough space so load the image now */
-	/* TODO: Consider whether to try to recover/retry a partially successful read */
-	io_result = io_read(image_handle, image_base, image_size, &bytes_read);
-	if ((io_result != 0) || (bytes_read < image_size)) {
-		WARN("Failed to load image id=%u (%i)\n", image_id, io_result);
-		goto exit;
+#if TRUSTED_BOARD_BOOT
+	if (plat_load_hash_start(image_id, dev_handle, image_base,
+				 image_size) == 0) {
+		io_result = load_image_hashed(image_handle, image_base,
+					      image_size);
+		if (io_result != 0) {
+			WARN("Failed to load image id=%u (%i)\n", image_id,
+			     io_result);
+			goto exit;
+		}
+	} else
+#endif
+	{
+		/* TODO: Consider whether to try to recover/retry a partially successful read */
+		io_result = io_read(image_handle, image_base, image_size,
+				    &bytes_read);
+		if ((io_result != 0) || (bytes_read < image_size)) {
+			WARN("Failed to load image id=%u (%i)\n", image_id,
+			     io_result);
+			goto exit;
+		}
 	}
 
 	INFO("Image id=%u loaded: 0x%lx - 0x%lx\n", image_id, image_base,
@@ -144,6 +247,29 @@ exit:
 }
 
 #if TRUSTED_BOARD_BOOT
+/*
+ * Authenticate a loaded image. On failure the image is wiped.
+ */
+static int auth_image(unsigned int image_id, image_info_t *image_data)
+{
+	int rc;
+
+	rc = auth_mod_verify_img(image_id,
+				 (void *)image_data->image_base,
+				 image_data->image_size);
+	if (rc != 0) {
+		plat_handle_image_error(image_id, rc);
+		/* Authentication error, zero memory and flush it right away. */
+		zero_normalmem((void *)image_data->image_base,
+			       image_data->image_size);
+		flush_dcache_range(image_data->image_base,
+				   image_data->image_size);
+		return -EAUTH;
+	}
+
+	return 0;
+}
+
 /*
  * This function uses recursion to authenticate the parent images up to the root
  * of trust.
@@ -172,20 +298,7 @@ static int load_auth_image_recursive(unsigned int image_id,
 	}
 
 	/* Authenticate it */
-	rc = auth_mod_verify_img(image_id,
-				 (void *)image_data->image_base,
-				 image_data->image_size);
-	if (rc != 0) {
-		plat_handle_image_error(image_id, rc);
-		/* Authentication error, zero memory and flush it right away. */
-		zero_normalmem((void *)image_data->image_base,
-			       image_data->image_size);
-		flush_dcache_range(image_data->image_base,
-				   image_data->image_size);
-		return -EAUTH;
-	}
-
-	return 0;
+	return auth_image(image_id, image_data);
 }
 #endif /* TRUSTED_BOARD_BOOT */
 
@@ -201,6 +314,33 @@ static int load_auth_image_internal(unsigned int image_id,
 	return load_image(image_id, image_data);
 }
 
+/*
+ * Final steps once an image is loaded and authenticated.
+ */
+static int load_auth_image_done(unsigned int image_id, image_info_t *image_data)
+{
+	int err;
+
+	/*
+	 * If loading of the image gets passed (along with its
+	 * authentication in case of Trusted-Boot flow) then measure
+	 * it (if MEASURED_BOOT flag is enabled).
+	 */
+	err = plat_mboot_measure_image(image_id, image_data);
+	if (err != 0) {
+		return err;
+	}
+
+	/*
+	 * Flush the image to main memory so that it can be executed
+	 * later by any CPU, regardless of cache and MMU state.
+	 */
+	flush_dcache_range(image_data->image_base,
+			   image_data->image_size);
+
+	return 0;
+}
+
 /*******************************************************************************
  * Generic function to load and authenticate an image. The image is actually
  * loaded by calling the 'load_image()' function. Therefore, it returns the
@@ -226,22 +366,7 @@ int load_auth_image(unsigned int image_id, image_info_t *image_data)
 #endif /* PSA_FWU_SUPPORT */
 
 	if (err == 0) {
-		/*
-		 * If loading of the image gets passed (along with its
-		 * authentication in case of Trusted-Boot flow) then measure
-		 * it (if MEASURED_BOOT flag is enabled).
-		 */
-		err = plat_mboot_measure_image(image_id, image_data);
-		if (err != 0) {
-			return err;
-		}
-
-		/*
-		 * Flush the image to main memory so that it can be executed
-		 * later by any CPU, regardless of cache and MMU state.
-		 */
-		flush_dcache_range(image_data->image_base,
-				   image_data->image_size);
+		err = load_auth_image_done(image_id, image_data);
 	}
 
 	return err;
@@ -5,17 +5,42 @@
  */
 
 #include <assert.h>
+#include <errno.h>
+#include <stdbool.h>
 #include <stdint.h>
 
 #include <arch_helpers.h>
 #include <common/bl_common.h>
 #include <common/debug.h>
 #include <common/image_decompress.h>
+#include <drivers/io/io_storage.h>
+#include <lib/utils_def.h>
+#include <plat/common/platform.h>
+
+/*
+ * In streaming mode, the compressed image is read from its source in
+ * chunks of this size into two buffers at the start of the temporary
+ * buffer: one is being inflated while the other one is being read.
+ */
+#ifndef IMAGE_DECOMPRESS_STREAM_CHUNK_SIZE
+#define IMAGE_DECOMPRESS_STREAM_CHUNK_SIZE	(16U * 1024U)
+#endif
+
+struct stream_reader {
+	uintptr_t handle;
+	size_t left;		/* Compressed bytes not yet consumed */
+	uintptr_t buf[2];
+	unsigned int cur;	/* Buffer of the outstanding read */
+	size_t pending;		/* Length of the outstanding read */
+};
 
 static uintptr_t decompressor_buf_base;
 static uint32_t decompressor_buf_size;
 static decompressor_t *decompressor;
+static stream_decompressor_t *stream_decompressor;
 static struct image_info saved_image_info;
+static unsigned int stream_image_id;
+static bool stream_pending;
 
 void image_decompress_init(uintptr_t buf_base, uint32_t buf_size,
 			   decompressor_t *_decompressor)
@@ -25,8 +50,15 @@ void image_decompress_init(uintptr_t buf_base, uint32_t buf_size,
 	decompressor = _decompressor;
 }
 
+void image_decompress_init_stream(stream_decompressor_t *_decompressor)
+{
+	stream_decompressor = _decompressor;
+}
+
 void image_decompress_prepare(struct image_info *info)
 {
+	stream_pending = false;
+
 	/*
 	 * If the image is compressed, it should be loaded into the temporary
 	 * buffer instead of its final destination.  We save image_info, then
@@ -38,12 +70,177 @@ void image_decompress_prepare(struct image_info *info)
 	info->image_max_size = decompressor_buf_size;
 }
 
+/*
+ * Prepare an image for streaming decompression: instead of loading the
+ * compressed image into the temporary buffer, image_decompress() pulls it
+ * from the image source in chunks and inflates it as it arrives, so the
+ * compressed size is not limited by the temporary buffer size.
+ */
+void image_decompress_prepare_stream(unsigned int image_id,
+				     struct image_info *info)
+{
+#if TRUSTED_BOARD_BOOT || MEASURED_BOOT
+	/*
+	 * load_auth_image() authenticates and measures the compressed image,
+	 * so it must be loaded into memory as a whole.
+	 */
+	image_decompress_prepare(info);
+#else
+	if (stream_decompressor == NULL) {
+		image_decompress_prepare(info);
+		return;
+	}
+
+	saved_image_info = *info;
+	stream_image_id = image_id;
+	stream_pending = true;
+
+	/* The input is read by image_decompress() */
+	info->h.attr |= IMAGE_ATTRIB_SKIP_LOADING;
+#endif
+}
+
+/* Start reading the next chunk of compressed input, if any */
+static int stream_read_start(struct stream_reader *rd)
+{
+	int ret;
+
+	rd->pending = MIN(rd->left, (size_t)IMAGE_DECOMPRESS_STREAM_CHUNK_SIZE);
+	if (rd->pending == 0U) {
+		return 0;
+	}
+
+	ret = io_read_async(rd->handle, rd->buf[rd->cur], rd->pending);
+	if (ret != 0) {
+		rd->pending = 0U;
+	}
+
+	return ret;
+}
+
+static int stream_read_wait(struct stream_reader *rd, size_t *bytes_read)
+{
+	int ret;
+
+	do {
+		ret = io_read_poll(rd->handle, bytes_read);
+	} while (ret == -EINPROGRESS);
+
+	return ret;
+}
+
+static int stream_read(void *ctx, uintptr_t *chunk, size_t *chunk_len)
+{
+	struct stream_reader *rd = ctx;
+	size_t bytes_read;
+	int ret;
+
+	if (rd->pending == 0U) {
+		/* End of input */
+		*chunk_len = 0U;
+		return 0;
+	}
+
+	ret = stream_read_wait(rd, &bytes_read);
+	if ((ret == 0) && (bytes_read < rd->pending)) {
+		ret = -EIO;
+	}
+	if (ret != 0) {
+		rd->pending = 0U;
+		return ret;
+	}
+
+	*chunk = rd->buf[rd->cur];
+	*chunk_len = rd->pending;
+	rd->left -= rd->pending;
+
+	/* Read ahead into the other buffer while this one is inflated */
+	rd->cur ^= 1U;
+
+	return stream_read_start(rd);
+}
+
+static int image_decompress_stream(struct image_info *info)
+{
+	struct stream_reader rd = { 0 };
+	uintptr_t dev_handle, image_spec, image_base, work_base;
+	size_t image_size, bytes_read, work_size;
+	int ret;
+
+	*info = saved_image_info;
+
+	assert(decompressor_buf_size > (2U * IMAGE_DECOMPRESS_STREAM_CHUNK_SIZE));
+
+	ret = plat_get_image_source(stream_image_id, &dev_handle, &image_spec);
+	if (ret != 0) {
+		WARN("Failed to obtain reference to image id=%u (%i)\n",
+		     stream_image_id, ret);
+		return ret;
+	}
+
+	ret = io_open(dev_handle, image_spec, &rd.handle);
+	if (ret != 0) {
+		WARN("Failed to access image id=%u (%i)\n", stream_image_id, ret);
+		return ret;
+	}
+
+	ret = io_size(rd.handle, &image_size);
+	if ((ret != 0) || (image_size == 0U)) {
+		WARN("Failed to determine the size of the image id=%u (%i)\n",
+		     stream_image_id, ret);
+		io_close(rd.handle);
+		return (ret != 0) ? ret : -EIO;
+	}
+
+	rd.left = image_size;
+	rd.buf[0] = decompressor_buf_base;
+	rd.buf[1] = decompressor_buf_base + IMAGE_DECOMPRESS_STREAM_CHUNK_SIZE;
+
+	/* The rest of the temporary buffer is the decompressor workspace */
+	work_base = decompressor_buf_base + (2U * IMAGE_DECOMPRESS_STREAM_CHUNK_SIZE);
+	work_size = decompressor_buf_size - (2U * IMAGE_DECOMPRESS_STREAM_CHUNK_SIZE);
+
+	image_base = info->image_base;
+
+	ret = stream_read_start(&rd);
+	if (ret == 0) {
+		ret = stream_decompressor(stream_read, &rd,
+					  &image_base, info->image_max_size,
+					  work_base, work_size);
+	}
+
+	/* Trailing input may still be in flight */
+	if (rd.pending != 0U) {
+		(void)stream_read_wait(&rd, &bytes_read);
+	}
+	io_close(rd.handle);
+
+	if (ret) {
+		ERROR("Failed to decompress image (err=%d)\n", ret);
+		return ret;
+	}
+
+	VERBOSE("Decompressed image id=%u: %zu to %zu bytes\n", stream_image_id,
+		image_size, (size_t)(image_base - info->image_base));
+
+	info->image_size = image_base - info->image_base;
+
+	flush_dcache_range(info->image_base, info->image_size);
+
+	return 0;
+}
+
 int image_decompress(struct image_info *info)
 {
 	uintptr_t compressed_image_base, image_base, work_base;
 	uint32_t compressed_image_size, work_size;
 	int ret;
 
+	if (stream_pending) {
+		stream_pending = false;
+		return image_decompress_stream(info);
+	}
+
 	/*
 	 * The size of compressed data has been filled by load_image().
 	 * Read it out before restoring image_info.
@@ -4,11 +4,10 @@
  * SPDX-License-Identifier: BSD-3-Clause
  */
 
-#include <stdarg.h>
 #include <assert.h>
+#include <stdint.h>
 
 #include <arm_acle.h>
-#include <common/debug.h>
 #include <common/tf_crc32.h>
 
 /* compute CRC using Arm intrinsic function
@@ -18,6 +17,10 @@
  * Platforms with CPU ARMv8.0 should make sure to add a compile switch
  * '-march=armv8-a+crc" for successful compilation of this file.
  *
+ * The bytes up to the first 8-byte boundary are handled one at a time,
+ * then the CRC is computed over aligned doublewords and the remaining
+ * bytes are again handled one at a time.
+ *
  * @crc: previous accumulated CRC
  * @buf: buffer base address
  * @size: the size of the buffer
@@ -33,7 +36,27 @@ uint32_t tf_crc32(uint32_t crc, const unsigned char *buf, size_t size)
 	size_t local_size = size;
 
 	/*
-	 * calculate CRC over byte data
+	 * calculate CRC over byte data up to 8-byte alignment
+	 */
+	while ((local_size != 0UL) &&
+	       (((uintptr_t)local_buf & (sizeof(uint64_t) - 1U)) != 0UL)) {
+		calc_crc = __crc32b(calc_crc, *local_buf);
+		local_buf++;
+		local_size--;
+	}
+
+	/*
+	 * calculate CRC over aligned doublewords
+	 */
+	while (local_size >= sizeof(uint64_t)) {
+		calc_crc = __crc32d(calc_crc,
+				    *(const uint64_t *)(const void *)local_buf);
+		local_buf += sizeof(uint64_t);
+		local_size -= sizeof(uint64_t);
+	}
+
+	/*
+	 * calculate CRC over the remaining byte data
 	 */
 	while (local_size != 0UL) {
 		calc_crc = __crc32b(calc_crc, *local_buf);
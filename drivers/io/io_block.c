@@ -6,6 +6,7 @@
 
 #include <assert.h>
 #include <errno.h>
+#include <stdbool.h>
 #include <string.h>
 
 #include <platform_def.h>
@@ -21,6 +22,17 @@ typedef struct {
 	uintptr_t		base;
 	unsigned long long	file_pos;
 	unsigned long long	size;
+	/*
+	 * The device has a single file position, so only one open at a
+	 * time. With FIP_PERSISTENT_BACKEND, io_fip holds the device open
+	 * for as long as its FIP source is in use.
+	 */
+	bool			in_use;
+	/* Outstanding asynchronous read */
+	bool			async_pending;
+	bool			async_done;
+	int			async_result;
+	size_t			async_len;
 } block_dev_state_t;
 
 #define is_power_of_2(x)	(((x) != 0U) && (((x) & ((x) - 1U)) == 0U))
@@ -35,6 +47,9 @@ static int block_read(io_entity_t *entity, uintptr_t buffer, size_t length,
 static int block_write(io_entity_t *entity, const uintptr_t buffer,
 		       size_t length, size_t *length_written);
 static int block_close(io_entity_t *entity);
+static int block_read_async(io_entity_t *entity, uintptr_t buffer,
+			    size_t length);
+static int block_read_poll(io_entity_t *entity, size_t *length_read);
 static int block_dev_open(const uintptr_t dev_spec, io_dev_info_t **dev_info);
 static int block_dev_close(io_dev_info_t *dev_info);
 
@@ -52,6 +67,8 @@ static const io_dev_funcs_t block_dev_funcs = {
 	.close		= block_close,
 	.dev_init	= NULL,
 	.dev_close	= block_dev_close,
+	.read_async	= block_read_async,
+	.read_poll	= block_read_poll,
 };
 
 static block_dev_state_t state_pool[MAX_IO_BLOCK_DEVICES];
@@ -60,11 +77,93 @@ static io_dev_info_t dev_info_pool[MAX_IO_BLOCK_DEVICES];
 /* Track number of allocated block state */
 static unsigned int block_dev_count;
 
+#if defined(IO_BLOCK_CACHE_ENTRIES)
+/*
+ * Optional LRU cache of whole blocks, used for reads which only cover
+ * part of a block. Such reads are typical for the GPT entries and the
+ * FIP header/ToC, which otherwise re-read the same blocks repeatedly.
+ * Devices with a block size larger than IO_BLOCK_CACHE_BLOCK_SIZE are
+ * not cached.
+ */
+#ifndef IO_BLOCK_CACHE_BLOCK_SIZE
+#define IO_BLOCK_CACHE_BLOCK_SIZE	U(512)
+#endif
+
+typedef struct {
+	const io_block_dev_spec_t *dev_spec;	/* NULL if line is unused */
+	int lba;
+	unsigned int age;
+} block_cache_line_t;
+
+static block_cache_line_t cache_lines[IO_BLOCK_CACHE_ENTRIES];
+static uint8_t cache_data[IO_BLOCK_CACHE_ENTRIES][IO_BLOCK_CACHE_BLOCK_SIZE];
+static unsigned int cache_clock;
+static unsigned int cache_hits;
+static unsigned int cache_misses;
+#endif
+
 io_type_t device_type_block(void)
 {
 	return IO_TYPE_BLOCK;
 }
 
+#if defined(IO_BLOCK_CACHE_ENTRIES)
+/* Return the cached data of a block, or NULL if not cached */
+static const uint8_t *block_cache_lookup(const io_block_dev_spec_t *dev_spec,
+					 int lba)
+{
+	unsigned int index;
+
+	for (index = 0U; index < IO_BLOCK_CACHE_ENTRIES; index++) {
+		if ((cache_lines[index].dev_spec == dev_spec) &&
+		    (cache_lines[index].lba == lba)) {
+			cache_lines[index].age = ++cache_clock;
+			cache_hits++;
+			return cache_data[index];
+		}
+	}
+
+	cache_misses++;
+	return NULL;
+}
+
+/* Insert a block in the cache, replacing the least recently used line */
+static const uint8_t *block_cache_fill(const io_block_dev_spec_t *dev_spec,
+				       int lba, uintptr_t data)
+{
+	unsigned int index, victim = 0U;
+
+	for (index = 0U; index < IO_BLOCK_CACHE_ENTRIES; index++) {
+		if (cache_lines[index].dev_spec == NULL) {
+			victim = index;
+			break;
+		}
+		if (cache_lines[index].age < cache_lines[victim].age) {
+			victim = index;
+		}
+	}
+
+	memcpy(cache_data[victim], (void *)data, dev_spec->block_size);
+	cache_lines[victim].dev_spec = dev_spec;
+	cache_lines[victim].lba = lba;
+	cache_lines[victim].age = ++cache_clock;
+
+	return cache_data[victim];
+}
+
+/* Drop all cached blocks of a device */
+static void block_cache_invalidate(const io_block_dev_spec_t *dev_spec)
+{
+	unsigned int index;
+
+	for (index = 0U; index < IO_BLOCK_CACHE_ENTRIES; index++) {
+		if (cache_lines[index].dev_spec == dev_spec) {
+			zeromem(&cache_lines[index], sizeof(cache_lines[index]));
+		}
+	}
+}
+#endif
+
 /* Locate a block state in the pool, specified by address */
 static int find_first_block_state(const io_block_dev_spec_t *dev_spec,
 				  unsigned int *index_out)
@@ -136,12 +235,17 @@ static int block_open(io_dev_info_t *dev_info, const uintptr_t spec,
 
 	region = (io_block_spec_t *)spec;
 	cur = (block_dev_state_t *)dev_info->info;
+	if (cur->in_use) {
+		return -EBUSY;
+	}
 	assert(((region->offset % cur->dev_spec->block_size) == 0) &&
 	       ((region->length % cur->dev_spec->block_size) == 0));
 
 	cur->base = region->offset;
 	cur->size = region->length;
 	cur->file_pos = 0;
+	cur->async_pending = false;
+	cur->in_use = true;
 
 	entity->info = (uintptr_t)cur;
 	return 0;
@@ -296,6 +400,31 @@ static int block_read(io_entity_t *entity, uintptr_t buffer, size_t length,
 		 */
 		lba = (cur->file_pos + cur->base) / block_size;
 
+#if defined(IO_BLOCK_CACHE_ENTRIES)
+		/* Partial block reads are served through the block cache */
+		if (((skip != 0U) || (left < block_size)) &&
+		    (block_size <= IO_BLOCK_CACHE_BLOCK_SIZE)) {
+			const uint8_t *data;
+
+			data = block_cache_lookup(cur->dev_spec, lba);
+			if (data == NULL) {
+				request = ops->read(lba, buf->offset,
+						    block_size);
+				if (request < block_size) {
+					return -EIO;
+				}
+				data = block_cache_fill(cur->dev_spec, lba,
+							buf->offset);
+			}
+
+			nbytes = MIN(block_size - skip, left);
+			memcpy((void *)(buffer + count), data + skip, nbytes);
+			cur->file_pos += nbytes;
+			count += nbytes;
+			continue;
+		}
+#endif
+
 #if defined(IO_BLOCK_DIRECT_COPY_BLOCK_ALIGN)
 		/* Optimization - see if we can read directly into (aligned) buffer */
 		if (skip == 0 && ((buffer + count) & (IO_BLOCK_DIRECT_COPY_BLOCK_ALIGN - 1U)) == 0) {
@@ -363,6 +492,87 @@ static int block_read(io_entity_t *entity, uintptr_t buffer, size_t length,
 	return 0;
 }
 
+/*
+ * Start an asynchronous read. Only block aligned reads of whole blocks
+ * are passed to the low level driver, anything else is read
+ * synchronously through block_read() and completed on the next poll.
+ */
+static int block_read_async(io_entity_t *entity, uintptr_t buffer,
+			    size_t length)
+{
+	block_dev_state_t *cur;
+	io_block_ops_t *ops;
+	size_t block_size;
+	int lba;
+	int result;
+
+	assert(entity->info != (uintptr_t)NULL);
+	cur = (block_dev_state_t *)entity->info;
+	ops = &(cur->dev_spec->ops);
+	block_size = cur->dev_spec->block_size;
+	assert(!cur->async_pending);
+	assert((length <= cur->size) && (length > 0U));
+
+	cur->async_pending = true;
+	cur->async_len = length;
+
+	if ((ops->read_start != NULL) && (ops->read_poll != NULL) &&
+	    ((cur->file_pos & (block_size - 1U)) == 0U) &&
+	    ((length & (block_size - 1U)) == 0U)) {
+		lba = (cur->file_pos + cur->base) / block_size;
+		result = ops->read_start(lba, buffer, length);
+		if (result == 0) {
+			cur->async_done = false;
+			return 0;
+		}
+		/* Driver declined, read synchronously */
+	}
+
+	cur->async_done = true;
+	cur->async_result = block_read(entity, buffer, length, &cur->async_len);
+
+	return 0;
+}
+
+static int block_read_poll(io_entity_t *entity, size_t *length_read)
+{
+	block_dev_state_t *cur;
+	io_block_ops_t *ops;
+	size_t nbytes;
+	int result;
+
+	assert(entity->info != (uintptr_t)NULL);
+	assert(length_read != NULL);
+	cur = (block_dev_state_t *)entity->info;
+	ops = &(cur->dev_spec->ops);
+
+	if (!cur->async_pending) {
+		return -EINVAL;
+	}
+
+	if (cur->async_done) {
+		/* File position was updated by block_read() */
+		result = cur->async_result;
+		*length_read = cur->async_len;
+	} else {
+		result = ops->read_poll(&nbytes);
+		if (result == -EINPROGRESS) {
+			return result;
+		}
+		if ((result == 0) && (nbytes < cur->async_len)) {
+			result = -EIO;
+		}
+		if (result == 0) {
+			cur->file_pos += cur->async_len;
+			*length_read = cur->async_len;
+		}
+	}
+
+	cur->async_pending = false;
+
+	return result;
+}
+
 /*
  * This function allows the caller to write any number of bytes
  * from any position. It hides from the caller that the low level
@@ -402,6 +612,10 @@ static int block_write(io_entity_t *entity, const uintptr_t buffer,
 	       (ops->read != 0) &&
 	       (ops->write != 0));
 
+#if defined(IO_BLOCK_CACHE_ENTRIES)
+	block_cache_invalidate(cur->dev_spec);
+#endif
+
 	/*
 	 * We don't know the number of bytes that we are going
 	 * to write in every iteration, because it will depend
@@ -509,6 +723,13 @@ static int block_write(io_entity_t *entity, const uintptr_t buffer,
 
 static int block_close(io_entity_t *entity)
 {
+	block_dev_state_t *cur;
+
+	assert(entity->info != (uintptr_t)NULL);
+
+	cur = (block_dev_state_t *)entity->info;
+	cur->in_use = false;
+
 	entity->info = (uintptr_t)NULL;
 	return 0;
 }
@@ -544,6 +765,9 @@ static int block_dev_open(const uintptr_t dev_spec, io_dev_info_t **dev_info)
 
 static int block_dev_close(io_dev_info_t *dev_info)
 {
+#if defined(IO_BLOCK_CACHE_ENTRIES)
+	block_cache_invalidate(((block_dev_state_t *)dev_info->info)->dev_spec);
+#endif
 	return free_dev_info(dev_info);
 }
 
@@ -565,3 +789,17 @@ int register_io_dev_block(const io_dev_connector_t **dev_con)
 		*dev_con = &block_dev_connector;
 	return result;
 }
+
+/* Return the block cache hit/miss counters */
+void io_block_get_cache_stats(unsigned int *hits, unsigned int *misses)
+{
+	assert((hits != NULL) && (misses != NULL));
+
+#if defined(IO_BLOCK_CACHE_ENTRIES)
+	*hits = cache_hits;
+	*misses = cache_misses;
+#else
+	*hits = 0U;
+	*misses = 0U;
+#endif
+}
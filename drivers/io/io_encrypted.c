@@ -28,6 +28,15 @@ static uintptr_t backend_dev_spec;
 static uintptr_t backend_handle;
 static uintptr_t backend_image_spec;
 
+/*
+ * Size of the chunks read from the backend when the platform supports
+ * streaming decryption. Each chunk is decrypted while the next one is
+ * being read.
+ */
+#ifndef ENC_STREAM_CHUNK_SIZE
+#define ENC_STREAM_CHUNK_SIZE	(16U * 1024U)
+#endif
+
 static io_dev_info_t enc_dev_info;
 static struct fw_enc_hdr header;
 
@@ -53,6 +62,25 @@ void plat_decrypt_context_leave(void)
 {
 }
 
+#pragma weak plat_decrypt_stream_start
+int plat_decrypt_stream_start(const struct fw_enc_hdr *hdr, const uint8_t *key,
+			      size_t key_len, unsigned int key_flags,
+			      size_t data_len)
+{
+	return -ENOTSUP;
+}
+
+#pragma weak plat_decrypt_stream_update
+void plat_decrypt_stream_update(uintptr_t data, size_t len)
+{
+}
+
+#pragma weak plat_decrypt_stream_finish
+int plat_decrypt_stream_finish(const struct fw_enc_hdr *hdr)
+{
+	return -ENOTSUP;
+}
+
 static inline int is_valid_header(struct fw_enc_hdr *hdr)
 {
 	if (hdr->magic == ENC_HEADER_MAGIC)
@@ -177,6 +205,63 @@ static int enc_file_len(io_entity_t *entity, size_t *length)
 	return result;
 }
 
+/* Wait for the outstanding backend read */
+static int enc_read_wait(size_t *bytes_read)
+{
+	int result;
+
+	do {
+		result = io_read_poll(backend_handle, bytes_read);
+	} while (result == -EINPROGRESS);
+
+	return result;
+}
+
+/*
+ * Read the payload in chunks, decrypting each chunk in place while the
+ * backend is reading the next one.
+ */
+static int enc_read_stream(uintptr_t buffer, size_t length, size_t *length_read)
+{
+	size_t offset = 0U;
+	size_t chunk, next = 0U;
+	size_t bytes_read;
+	int result;
+
+	chunk = MIN(length, (size_t)ENC_STREAM_CHUNK_SIZE);
+	result = io_read_async(backend_handle, buffer, chunk);
+
+	while (result == 0) {
+		result = enc_read_wait(&bytes_read);
+		if ((result == 0) && (bytes_read < chunk)) {
+			result = -EIO;
+		}
+		if (result != 0) {
+			break;
+		}
+
+		/* Start reading the next chunk, then decrypt this one */
+		if ((offset + chunk) < length) {
+			next = MIN(length - offset - chunk,
+				   (size_t)ENC_STREAM_CHUNK_SIZE);
+			result = io_read_async(backend_handle,
+					       buffer + offset + chunk, next);
+		}
+
+		plat_decrypt_stream_update(buffer + offset, chunk);
+		offset += chunk;
+
+		if ((result != 0) || (offset == length)) {
+			break;
+		}
+		chunk = next;
+	}
+
+	*length_read = offset;
+
+	return result;
+}
+
 static int enc_file_read(io_entity_t *entity, uintptr_t buffer, size_t length,
 			 size_t *length_read)
 {
@@ -207,6 +292,28 @@ static int enc_file_read(io_entity_t *entity, uintptr_t buffer, size_t length,
 		return -ENOENT;
 	}
 
+	/* Decrypt chunks as they arrive, with a single tag check at the end */
+	if (plat_decrypt_stream_start(&header, key, key_len, key_flags,
+				      length) == 0) {
+		memset(key, 0, key_len);
+
+		result = enc_read_stream(buffer, length, length_read);
+		if (plat_decrypt_stream_finish(&header) != 0) {
+			/* Never leave a partially decrypted payload behind */
+			memset((void *)buffer, 0, *length_read);
+			if (result == 0) {
+				ERROR("File decryption failed\n");
+				return -ENOENT;
+			}
+		}
+		if (result != 0) {
+			WARN("Failed to read encrypted payload (%i)\n", result);
+			return -ENOENT;
+		}
+
+		return 0;
+	}
+
 	/* Allow for streaming io decrypt */
 	plat_decrypt_context_enter(&header, key, key_len, key_flags);
 
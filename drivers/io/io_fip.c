@@ -6,6 +6,7 @@
 
 #include <assert.h>
 #include <errno.h>
+#include <stdbool.h>
 #include <stdint.h>
 #include <string.h>
 
@@ -25,6 +26,10 @@
 #define MAX_FIP_DEVICES		1
 #endif
 
+#ifndef MAX_FIP_FILES
+#define MAX_FIP_FILES		1
+#endif
+
 /* Useful for printing UUIDs when debugging.*/
 #define PRINT_UUID2(x)								\
 	"%08x-%04hx-%04hx-%02hhx%02hhx-%02hhx%02hhx%02hhx%02hhx%02hhx%02hhx",	\
@@ -33,32 +38,82 @@
 		x.node[0], x.node[1], x.node[2], x.node[3],			\
 		x.node[4], x.node[5]
 
+#if defined(FIP_TOC_INDEX_ENTRIES)
+/*
+ * With FIP_TOC_INDEX_ENTRIES defined, fip_dev_init() reads the ToC once
+ * into an index sorted by UUID, and fip_file_open() locates entries with
+ * a binary search without accessing the backend. The index is kept when
+ * the device is re-initialized from the same backend source. If the ToC
+ * has more entries than the index can hold, the index is not used and
+ * entries are looked up in the backend as usual.
+ */
 typedef struct {
-	unsigned int file_pos;
-	fip_toc_entry_t entry;
-} fip_file_state_t;
+	uuid_t uuid;
+	uint64_t offset_address;
+	uint64_t size;
+} fip_toc_index_entry_t;
+#endif
 
 /*
- * Maintain dev_spec per FIP Device
- * TODO - Add backend handles and file state
- * per FIP device here once backends like io_memmap
- * can support multiple open files
+ * Maintain dev_spec and backend per FIP Device, so that several FIP
+ * devices (e.g. a primary and a recovery FIP) can be in use at once.
  */
 typedef struct {
 	uintptr_t dev_spec;
 	uint16_t plat_toc_flag;
+	uintptr_t backend_dev_handle;
+	uintptr_t backend_image_spec;
+	/* Location of the FIP the header and ToC were read from */
+	io_block_spec_t backend_block_spec;
+	bool backend_source_valid;
+#if defined(FIP_PERSISTENT_BACKEND)
+	/*
+	 * With FIP_PERSISTENT_BACKEND the backend handle opened by
+	 * fip_dev_init() is kept open until the FIP device is re-initialized
+	 * or closed, so that file open/read operations do not have to open,
+	 * seek and close the backend every time. Platforms should only
+	 * re-initialize the FIP device when the FIP source changes, so the
+	 * session lasts across images. The backend must not be opened by
+	 * anyone else while the session is active.
+	 */
+	uintptr_t backend_session_handle;
+	/* The session handle is held by an asynchronous read */
+	bool backend_session_busy;
+#endif
+#if defined(FIP_TOC_INDEX_ENTRIES)
+	fip_toc_index_entry_t toc_index[FIP_TOC_INDEX_ENTRIES];
+	unsigned int toc_index_count;
+	bool toc_index_valid;
+#endif
 } fip_dev_state_t;
 
+typedef struct {
+	unsigned int file_pos;
+	fip_toc_entry_t entry;
+	/* Backend handle of an outstanding asynchronous read, if any */
+	uintptr_t async_backend;
+	/* FIP device the file is open on, NULL for a free slot */
+	fip_dev_state_t *dev;
+} fip_file_state_t;
+
 /*
- * Only one file can be open across all FIP device
- * as backends like io_memmap don't support
- * multiple open files. The file state and
- * backend handle should be maintained per FIP device
- * if the same support is available in the backend
+ * Open files are kept in a pool of MAX_FIP_FILES entries, shared by all
+ * FIP devices. Files on the same FIP share its backend, so backends like
+ * io_memmap that only support one open file are only held open for the
+ * duration of each read (or for the whole session with
+ * FIP_PERSISTENT_BACKEND). Accesses from several files are serialized on
+ * the backend: while an asynchronous read is outstanding, other accesses
+ * to the same FIP fail with -EBUSY.
  */
-static fip_file_state_t current_fip_file = {0};
-static uintptr_t backend_dev_handle;
-static uintptr_t backend_image_spec;
+static fip_file_state_t file_pool[MAX_FIP_FILES];
+
+#if defined(FIP_PERSISTENT_BACKEND)
+/* Number of backend opens served by the session handle */
+static unsigned int backend_opens_saved;
+#endif
+
+/* Number of FIP header and ToC entry reads from the backend */
+static unsigned int toc_reads;
 
 static fip_dev_state_t state_pool[MAX_FIP_DEVICES];
 static io_dev_info_t dev_info_pool[MAX_FIP_DEVICES];
@@ -74,6 +129,9 @@ static int fip_file_len(io_entity_t *entity, size_t *length);
 static int fip_file_read(io_entity_t *entity, uintptr_t buffer, size_t length,
 			  size_t *length_read);
 static int fip_file_close(io_entity_t *entity);
+static int fip_file_read_async(io_entity_t *entity, uintptr_t buffer,
+			       size_t length);
+static int fip_file_read_poll(io_entity_t *entity, size_t *length_read);
 static int fip_dev_init(io_dev_info_t *dev_info, const uintptr_t init_params);
 static int fip_dev_close(io_dev_info_t *dev_info);
 
@@ -95,6 +153,177 @@ static inline int is_valid_header(fip_toc_header_t *header)
 }
 
 
+/* Obtain a backend handle, reusing the session handle if available */
+static int fip_backend_open(fip_dev_state_t *state, uintptr_t *backend_handle)
+{
+#if defined(FIP_PERSISTENT_BACKEND)
+	if (state->backend_session_handle != (uintptr_t)NULL) {
+		/* The cursor belongs to an outstanding asynchronous read */
+		if (state->backend_session_busy) {
+			return -EBUSY;
+		}
+		*backend_handle = state->backend_session_handle;
+		backend_opens_saved++;
+		return 0;
+	}
+#endif
+	return io_open(state->backend_dev_handle, state->backend_image_spec,
+		       backend_handle);
+}
+
+
+/* Release a backend handle obtained through fip_backend_open() */
+static void fip_backend_close(fip_dev_state_t *state, uintptr_t backend_handle)
+{
+#if defined(FIP_PERSISTENT_BACKEND)
+	if (backend_handle == state->backend_session_handle) {
+		return;
+	}
+#endif
+	io_close(backend_handle);
+}
+
+
+/* Close the backend session handle, if any */
+static void fip_backend_session_end(fip_dev_state_t *state)
+{
+#if defined(FIP_PERSISTENT_BACKEND)
+	if (state->backend_session_handle != (uintptr_t)NULL) {
+		io_close(state->backend_session_handle);
+		state->backend_session_handle = (uintptr_t)NULL;
+		state->backend_session_busy = false;
+	}
+#endif
+}
+
+
+/*
+ * Check whether a backend source is the one the header and ToC were read
+ * from. Platforms update a static block spec in place when they move to
+ * another FIP location, so block specs are compared by value.
+ */
+static bool fip_backend_source_unchanged(const fip_dev_state_t *state,
+					 uintptr_t dev_handle,
+					 uintptr_t image_spec)
+{
+	const io_block_spec_t *block_spec = (io_block_spec_t *)image_spec;
+	io_type_t type;
+
+	if (!state->backend_source_valid ||
+	    (dev_handle != state->backend_dev_handle) ||
+	    (image_spec != state->backend_image_spec)) {
+		return false;
+	}
+
+	type = ((io_dev_info_t *)dev_handle)->funcs->type();
+	if ((type != IO_TYPE_MEMMAP) && (type != IO_TYPE_BLOCK) &&
+	    (type != IO_TYPE_MTD)) {
+		return true;
+	}
+
+	return (block_spec->offset == state->backend_block_spec.offset) &&
+		(block_spec->length == state->backend_block_spec.length);
+}
+
+
+/* Record the backend source the header and ToC were read from */
+static void fip_backend_source_save(fip_dev_state_t *state)
+{
+	io_type_t type;
+
+	type = ((io_dev_info_t *)state->backend_dev_handle)->funcs->type();
+	if ((type == IO_TYPE_MEMMAP) || (type == IO_TYPE_BLOCK) ||
+	    (type == IO_TYPE_MTD)) {
+		state->backend_block_spec =
+			*(io_block_spec_t *)state->backend_image_spec;
+	}
+	state->backend_source_valid = true;
+}
+
+
+#if defined(FIP_TOC_INDEX_ENTRIES)
+/*
+ * Read the ToC from the backend, which must be positioned just past the
+ * FIP header, into the UUID sorted index.
+ */
+static void fip_toc_index_build(fip_dev_state_t *state,
+				uintptr_t backend_handle)
+{
+	fip_toc_index_entry_t *toc_index = state->toc_index;
+	static const uuid_t uuid_null = { {0} }; /* Double braces for clang */
+	fip_toc_entry_t entry;
+	size_t bytes_read;
+	unsigned int i;
+	int result;
+
+	state->toc_index_valid = false;
+	state->toc_index_count = 0U;
+
+	for (;;) {
+		result = io_read(backend_handle, (uintptr_t)&entry,
+				 sizeof(entry), &bytes_read);
+		toc_reads++;
+		if ((result != 0) || (bytes_read != sizeof(entry))) {
+			WARN("Failed to read FIP ToC (%i)\n", result);
+			return;
+		}
+
+		if (compare_uuids(&entry.uuid, &uuid_null) == 0) {
+			break;
+		}
+
+		if (state->toc_index_count ==
+		    (unsigned int)FIP_TOC_INDEX_ENTRIES) {
+			VERBOSE("FIP ToC exceeds index, using backend\n");
+			return;
+		}
+
+		/* Insertion sort on UUID, the ToC is small */
+		for (i = state->toc_index_count; i > 0U; i--) {
+			if (compare_uuids(&toc_index[i - 1U].uuid,
+					  &entry.uuid) <= 0) {
+				break;
+			}
+			toc_index[i] = toc_index[i - 1U];
+		}
+		toc_index[i].uuid = entry.uuid;
+		toc_index[i].offset_address = entry.offset_address;
+		toc_index[i].size = entry.size;
+		state->toc_index_count++;
+	}
+
+	VERBOSE("FIP ToC indexed, %u entries\n", state->toc_index_count);
+	state->toc_index_valid = true;
+}
+
+
+/* Look up a UUID in the ToC index */
+static const fip_toc_index_entry_t *fip_toc_index_find(
+		const fip_dev_state_t *state, const uuid_t *uuid)
+{
+	const fip_toc_index_entry_t *toc_index = state->toc_index;
+	unsigned int lo = 0U, hi = state->toc_index_count;
+	unsigned int mid;
+	int cmp;
+
+	while (lo < hi) {
+		mid = lo + ((hi - lo) / 2U);
+		cmp = compare_uuids(&toc_index[mid].uuid, uuid);
+		if (cmp == 0) {
+			return &toc_index[mid];
+		}
+		if (cmp < 0) {
+			lo = mid + 1U;
+		} else {
+			hi = mid;
+		}
+	}
+
+	return NULL;
+}
+#endif
+
+
 /* Identify the device type as a virtual driver */
 static io_type_t device_type_fip(void)
 {
@@ -117,6 +346,8 @@ static const io_dev_funcs_t fip_dev_funcs = {
 	.close = fip_file_close,
 	.dev_init = fip_dev_init,
 	.dev_close = fip_dev_close,
+	.read_async = fip_file_read_async,
+	.read_poll = fip_file_read_poll,
 };
 
 /* Locate a file state in the pool, specified by address */
@@ -183,8 +414,8 @@ static int free_dev_info(io_dev_info_t *dev_info)
 
 /*
  * Multiple FIP devices can be opened depending on the value of
- * MAX_FIP_DEVICES. Given that there is only one backend, only a
- * single file can be open at a time by any FIP device.
+ * MAX_FIP_DEVICES, each with its own backend. Up to MAX_FIP_FILES
+ * files can be open at a time across all FIP devices.
  */
 static int fip_dev_open(const uintptr_t dev_spec,
 			 io_dev_info_t **dev_info)
@@ -218,26 +449,40 @@ static int fip_dev_init(io_dev_info_t *dev_info, const uintptr_t init_params)
 	int result;
 	unsigned int image_id = (unsigned int)init_params;
 	uintptr_t backend_handle;
+	uintptr_t dev_handle;
+	uintptr_t image_spec;
 	fip_toc_header_t header;
 	size_t bytes_read;
 	fip_dev_state_t *state;
+	bool unchanged;
 
 	assert(dev_info != NULL);
 
 	state = (fip_dev_state_t *)dev_info->info;
 
+	/*
+	 * The platform layer may need to probe the backend device, so a
+	 * session from a previous initialization must be ended first.
+	 */
+	fip_backend_session_end(state);
+
 	/* Obtain a reference to the image by querying the platform layer */
-	result = plat_get_image_source(image_id, &backend_dev_handle,
-				       &backend_image_spec);
+	result = plat_get_image_source(image_id, &dev_handle, &image_spec);
 	if (result != 0) {
 		WARN("Failed to obtain reference to image id=%u (%i)\n",
 			image_id, result);
+		state->backend_source_valid = false;
 		result = -ENOENT;
 		goto fip_dev_init_exit;
 	}
 
+	unchanged = fip_backend_source_unchanged(state, dev_handle, image_spec);
+	state->backend_dev_handle = dev_handle;
+	state->backend_image_spec = image_spec;
+	state->backend_source_valid = false;
+
 	/* Attempt to access the FIP image */
-	result = io_open(backend_dev_handle, backend_image_spec,
+	result = io_open(state->backend_dev_handle, state->backend_image_spec,
 			 &backend_handle);
 	if (result != 0) {
 		WARN("Failed to access image id=%u (%i)\n", image_id, result);
@@ -245,8 +490,19 @@ static int fip_dev_init(io_dev_info_t *dev_info, const uintptr_t init_params)
 		goto fip_dev_init_exit;
 	}
 
+	if (unchanged) {
+		/* Header and ToC index are still valid for this source */
+		VERBOSE("FIP source unchanged.\n");
+		result = 0;
+		goto fip_dev_init_done;
+	}
+
+#if defined(FIP_TOC_INDEX_ENTRIES)
+	state->toc_index_valid = false;
+#endif
 	result = io_read(backend_handle, (uintptr_t)&header, sizeof(header),
 			&bytes_read);
+	toc_reads++;
 	if (result == 0) {
 		if (!is_valid_header(&header)) {
 			WARN("Firmware Image Package header check failed.\n");
@@ -258,28 +514,68 @@ static int fip_dev_init(io_dev_info_t *dev_info, const uintptr_t init_params)
 			 * bits [32-47] in fip header.
 			 */
 			state->plat_toc_flag = (header.flags >> 32) & 0xffff;
+#if defined(FIP_TOC_INDEX_ENTRIES)
+			fip_toc_index_build(state, backend_handle);
+#endif
 		}
 	}
 
+ fip_dev_init_done:
+	if (result == 0) {
+		fip_backend_source_save(state);
+	}
+
+#if defined(FIP_PERSISTENT_BACKEND)
+	if (result == 0) {
+		/* Keep the backend open for the rest of the session */
+		state->backend_session_handle = backend_handle;
+	} else {
+		io_close(backend_handle);
+	}
+#else
 	io_close(backend_handle);
+#endif
 
  fip_dev_init_exit:
 	return result;
 }
 
-/* Close a connection to the FIP device */
+/* Close a connection to the FIP device, which must have no open files */
 static int fip_dev_close(io_dev_info_t *dev_info)
 {
-	/* TODO: Consider tracking open files and cleaning them up here */
+	fip_dev_state_t *state = (fip_dev_state_t *)dev_info->info;
+	unsigned int index;
 
-	/* Clear the backend. */
-	backend_dev_handle = (uintptr_t)NULL;
-	backend_image_spec = (uintptr_t)NULL;
+	for (index = 0U; index < (unsigned int)MAX_FIP_FILES; index++) {
+		if (file_pool[index].dev == state) {
+			WARN("fip_dev_close: FIP files still open.\n");
+			return -EBUSY;
+		}
+	}
+
+	/* The backend is cleared along with the rest of the device state */
+	fip_backend_session_end(state);
 
 	return free_dev_info(dev_info);
 }
 
 
+/* Allocate a file state from the pool */
+static fip_file_state_t *allocate_file_state(fip_dev_state_t *state)
+{
+	unsigned int index;
+
+	for (index = 0U; index < (unsigned int)MAX_FIP_FILES; index++) {
+		if (file_pool[index].dev == NULL) {
+			file_pool[index].dev = state;
+			return &file_pool[index];
+		}
+	}
+
+	return NULL;
+}
+
+
 /* Open a file for access from package. */
 static int fip_file_open(io_dev_info_t *dev_info, const uintptr_t spec,
 			 io_entity_t *entity)
@@ -288,29 +584,54 @@ static int fip_file_open(io_dev_info_t *dev_info, const uintptr_t spec,
 	uintptr_t backend_handle;
 	const io_uuid_spec_t *uuid_spec = (io_uuid_spec_t *)spec;
 	static const uuid_t uuid_null = { {0} }; /* Double braces for clang */
+	fip_dev_state_t *state;
+	fip_file_state_t *fp;
 	size_t bytes_read;
 	int found_file = 0;
 
+	assert(dev_info != NULL);
 	assert(uuid_spec != NULL);
 	assert(entity != NULL);
 
-	/* Can only have one file open at a time for the moment. We need to
-	 * track state like file cursor position. We know the header lives at
-	 * offset zero, so this entry should never be zero for an active file.
-	 * When the system supports dynamic memory allocation we can allow more
-	 * than one open file at a time if needed.
+	state = (fip_dev_state_t *)dev_info->info;
+
+	/* Up to MAX_FIP_FILES files can be open, each tracking its own
+	 * file cursor position.
 	 */
-	if (current_fip_file.entry.offset_address != 0U) {
-		WARN("fip_file_open : Only one open file at a time.\n");
+	fp = allocate_file_state(state);
+	if (fp == NULL) {
+		WARN("fip_file_open: Too many open files.\n");
 		return -ENFILE;
 	}
 
+#if defined(FIP_TOC_INDEX_ENTRIES)
+	if (state->toc_index_valid) {
+		const fip_toc_index_entry_t *idx;
+
+		idx = fip_toc_index_find(state, &uuid_spec->uuid);
+		if (idx == NULL) {
+			zeromem(fp, sizeof(*fp));
+			return -ENOENT;
+		}
+
+		fp->entry.uuid = idx->uuid;
+		fp->entry.offset_address = idx->offset_address;
+		fp->entry.size = idx->size;
+		fp->entry.flags = 0U;
+		fp->file_pos = 0;
+		entity->info = (uintptr_t)fp;
+
+		return 0;
+	}
+#endif
+
 	/* Attempt to access the FIP image */
-	result = io_open(backend_dev_handle, backend_image_spec,
-			 &backend_handle);
+	result = fip_backend_open(state, &backend_handle);
 	if (result != 0) {
 		WARN("Failed to open Firmware Image Package (%i)\n", result);
-		result = -ENOENT;
+		if (result != -EBUSY) {
+			result = -ENOENT;
+		}
 		goto fip_file_open_exit;
 	}
 
@@ -326,11 +647,12 @@ static int fip_file_open(io_dev_info_t *dev_info, const uintptr_t spec,
 	found_file = 0;
 	do {
 		result = io_read(backend_handle,
-				 (uintptr_t)&current_fip_file.entry,
-				 sizeof(current_fip_file.entry),
+				 (uintptr_t)&fp->entry,
+				 sizeof(fp->entry),
 				 &bytes_read);
+		toc_reads++;
 		if (result == 0) {
-			if (compare_uuids(&current_fip_file.entry.uuid,
+			if (compare_uuids(&fp->entry.uuid,
 					  &uuid_spec->uuid) == 0) {
 				found_file = 1;
 			}
@@ -339,26 +661,29 @@ static int fip_file_open(io_dev_info_t *dev_info, const uintptr_t spec,
 			goto fip_file_open_close;
 		}
 	} while ((found_file == 0) &&
-			(compare_uuids(&current_fip_file.entry.uuid,
+			(compare_uuids(&fp->entry.uuid,
 				&uuid_null) != 0));
 
 	if (found_file == 1) {
 		/* All fine. Update entity info with file state and return. Set
-		 * the file position to 0. The 'current_fip_file.entry' holds
-		 * the base and size of the file.
+		 * the file position to 0. The 'fp->entry' holds the base and
+		 * size of the file.
 		 */
-		current_fip_file.file_pos = 0;
-		entity->info = (uintptr_t)&current_fip_file;
+		fp->file_pos = 0;
+		entity->info = (uintptr_t)fp;
 	} else {
 		/* Did not find the file in the FIP. */
-		current_fip_file.entry.offset_address = 0;
 		result = -ENOENT;
 	}
 
  fip_file_open_close:
-	io_close(backend_handle);
+	fip_backend_close(state, backend_handle);
 
  fip_file_open_exit:
+	if (result != 0) {
+		/* Return the file state to the pool */
+		zeromem(fp, sizeof(*fp));
+	}
 	return result;
 }
 
@@ -389,17 +714,18 @@ static int fip_file_read(io_entity_t *entity, uintptr_t buffer, size_t length,
 	assert(length_read != NULL);
 	assert(entity->info != (uintptr_t)NULL);
 
+	fp = (fip_file_state_t *)entity->info;
+
 	/* Open the backend, attempt to access the blob image */
-	result = io_open(backend_dev_handle, backend_image_spec,
-			 &backend_handle);
+	result = fip_backend_open(fp->dev, &backend_handle);
 	if (result != 0) {
 		WARN("Failed to open FIP (%i)\n", result);
-		result = -ENOENT;
+		if (result != -EBUSY) {
+			result = -ENOENT;
+		}
 		goto fip_file_read_exit;
 	}
 
-	fp = (fip_file_state_t *)entity->info;
-
 	/* Seek to the position in the FIP where the payload lives */
 	file_offset = fp->entry.offset_address + fp->file_pos;
 	result = io_seek(backend_handle, IO_SEEK_SET,
@@ -424,21 +750,112 @@ static int fip_file_read(io_entity_t *entity, uintptr_t buffer, size_t length,
 
 /* Close the backend. */
  fip_file_read_close:
-	io_close(backend_handle);
+	fip_backend_close(fp->dev, backend_handle);
 
  fip_file_read_exit:
 	return result;
 }
 
 
+/* Start reading data from a file in package */
+static int fip_file_read_async(io_entity_t *entity, uintptr_t buffer,
+			       size_t length)
+{
+	int result;
+	fip_file_state_t *fp;
+	size_t file_offset;
+	uintptr_t backend_handle;
+
+	assert(entity != NULL);
+	assert(entity->info != (uintptr_t)NULL);
+
+	fp = (fip_file_state_t *)entity->info;
+	assert(fp->async_backend == (uintptr_t)NULL);
+
+	/* The backend is held open until the read has been polled */
+	result = fip_backend_open(fp->dev, &backend_handle);
+	if (result != 0) {
+		WARN("Failed to open FIP (%i)\n", result);
+		return (result == -EBUSY) ? result : -ENOENT;
+	}
+
+	file_offset = fp->entry.offset_address + fp->file_pos;
+	result = io_seek(backend_handle, IO_SEEK_SET,
+			 (signed long long)file_offset);
+	if (result == 0) {
+		result = io_read_async(backend_handle, buffer, length);
+	}
+
+	if (result != 0) {
+		WARN("fip_file_read_async: failed to start (%i)\n", result);
+		fip_backend_close(fp->dev, backend_handle);
+		return -ENOENT;
+	}
+
+	fp->async_backend = backend_handle;
+#if defined(FIP_PERSISTENT_BACKEND)
+	/* Other files must not move the session handle until polled */
+	if (backend_handle == fp->dev->backend_session_handle) {
+		fp->dev->backend_session_busy = true;
+	}
+#endif
+
+	return 0;
+}
+
+
+/* Poll an asynchronous read of a file in package */
+static int fip_file_read_poll(io_entity_t *entity, size_t *length_read)
+{
+	int result;
+	fip_file_state_t *fp;
+	size_t bytes_read;
+
+	assert(entity != NULL);
+	assert(length_read != NULL);
+	assert(entity->info != (uintptr_t)NULL);
+
+	fp = (fip_file_state_t *)entity->info;
+	if (fp->async_backend == (uintptr_t)NULL) {
+		return -EINVAL;
+	}
+
+	result = io_read_poll(fp->async_backend, &bytes_read);
+	if (result == -EINPROGRESS) {
+		return result;
+	}
+
+#if defined(FIP_PERSISTENT_BACKEND)
+	if (fp->async_backend == fp->dev->backend_session_handle) {
+		fp->dev->backend_session_busy = false;
+	}
+#endif
+	fip_backend_close(fp->dev, fp->async_backend);
+	fp->async_backend = (uintptr_t)NULL;
+
+	if (result != 0) {
+		WARN("Failed to read payload (%i)\n", result);
+		return -ENOENT;
+	}
+
+	*length_read = bytes_read;
+	fp->file_pos += bytes_read;
+
+	return 0;
+}
+
+
 /* Close a file in package */
 static int fip_file_close(io_entity_t *entity)
 {
-	/* Clear our current file pointer.
+	fip_file_state_t *fp = (fip_file_state_t *)entity->info;
+
+	/* Return the file state to the pool.
 	 * If we had malloc() we would free() here.
 	 */
-	if (current_fip_file.entry.offset_address != 0U) {
-		zeromem(&current_fip_file, sizeof(current_fip_file));
+	if (fp != NULL) {
+		assert(fp->async_backend == (uintptr_t)NULL);
+		zeromem(fp, sizeof(*fp));
 	}
 
 	/* Clear the Entity info. */
@@ -479,3 +896,19 @@ int fip_dev_get_plat_toc_flag(io_dev_info_t *dev_info, uint16_t *plat_toc_flag)
 
 	return 0;
 }
+
+/* Return the number of FIP header and ToC entry reads from the backend */
+unsigned int fip_dev_get_toc_reads(void)
+{
+	return toc_reads;
+}
+
+/* Return the number of backend opens avoided by the persistent session */
+unsigned int fip_dev_get_backend_opens_saved(void)
+{
+#if defined(FIP_PERSISTENT_BACKEND)
+	return backend_opens_saved;
+#else
+	return 0U;
+#endif
+}
@@ -5,6 +5,7 @@
  */
 
 #include <assert.h>
+#include <errno.h>
 #include <string.h>
 
 #include <platform_def.h>
@@ -27,6 +28,8 @@ typedef struct {
 	uintptr_t		base;
 	unsigned long long	file_pos;
 	unsigned long long	size;
+	/* Length of the outstanding asynchronous read, if any */
+	size_t			async_len;
 } memmap_file_state_t;
 
 static memmap_file_state_t current_memmap_file = {0};
@@ -50,6 +53,9 @@ static int memmap_block_write(io_entity_t *entity, const uintptr_t buffer,
 			      size_t length, size_t *length_written);
 static int memmap_block_close(io_entity_t *entity);
 static int memmap_dev_close(io_dev_info_t *dev_info);
+static int memmap_block_read_async(io_entity_t *entity, uintptr_t buffer,
+				   size_t length);
+static int memmap_block_read_poll(io_entity_t *entity, size_t *length_read);
 
 
 static const io_dev_connector_t memmap_dev_connector = {
@@ -67,10 +73,12 @@ static const io_dev_funcs_t memmap_dev_funcs = {
 	.close = memmap_block_close,
 	.dev_init = NULL,
 	.dev_close = memmap_dev_close,
+	.read_async = memmap_block_read_async,
+	.read_poll = memmap_block_read_poll,
 };
 
 
-/* No state associated with this device so structure can be const */
+/* The only device state is the optional configuration (dev_spec) */
 static io_dev_info_t memmap_dev_info = {
 	.funcs = &memmap_dev_funcs,
 	.info = (uintptr_t)NULL
@@ -78,10 +86,12 @@ static io_dev_info_t memmap_dev_info = {
 
 
 /* Open a connection to the memmap device */
-static int memmap_dev_open(const uintptr_t dev_spec __unused,
+static int memmap_dev_open(const uintptr_t dev_spec,
 			   io_dev_info_t **dev_info)
 {
 	assert(dev_info != NULL);
+	/* dev_spec is an optional io_memmap_dev_spec_t */
+	memmap_dev_info.info = dev_spec;
 	*dev_info = &memmap_dev_info;
 	return 0;
 }
@@ -169,8 +179,10 @@ static int memmap_block_len(io_entity_t *entity, size_t *length)
 static int memmap_block_read(io_entity_t *entity, uintptr_t buffer,
 			     size_t length, size_t *length_read)
 {
+	const io_memmap_dev_spec_t *spec;
 	memmap_file_state_t *fp;
 	unsigned long long pos_after;
+	int result;
 
 	assert(entity != NULL);
 	assert(length_read != NULL);
@@ -181,8 +193,17 @@ static int memmap_block_read(io_entity_t *entity, uintptr_t buffer,
 	pos_after = fp->file_pos + length;
 	assert((pos_after >= fp->file_pos) && (pos_after <= fp->size));
 
-	memcpy((void *)buffer,
-	       (void *)((uintptr_t)(fp->base + fp->file_pos)), length);
+	spec = (const io_memmap_dev_spec_t *)entity->dev_handle->info;
+	if ((spec != NULL) && (spec->copy != NULL)) {
+		result = spec->copy(buffer,
+				    (uintptr_t)(fp->base + fp->file_pos), length);
+		if (result != 0) {
+			return result;
+		}
+	} else {
+		memcpy((void *)buffer,
+		       (void *)((uintptr_t)(fp->base + fp->file_pos)), length);
+	}
 
 	*length_read = length;
 
@@ -193,6 +214,85 @@ static int memmap_block_read(io_entity_t *entity, uintptr_t buffer,
 }
 
 
+/* Start reading data from a file on the memmap device */
+static int memmap_block_read_async(io_entity_t *entity, uintptr_t buffer,
+				   size_t length)
+{
+	const io_memmap_dev_spec_t *spec;
+	memmap_file_state_t *fp;
+	unsigned long long pos_after;
+	size_t length_read;
+	int result;
+
+	assert(entity != NULL);
+
+	spec = (const io_memmap_dev_spec_t *)entity->dev_handle->info;
+	fp = (memmap_file_state_t *) entity->info;
+	assert(fp->async_len == 0U);
+
+	if ((spec == NULL) || (spec->copy_start == NULL)) {
+		/* No copy engine, copy now and complete on the next poll */
+		result = memmap_block_read(entity, buffer, length, &length_read);
+		if (result != 0) {
+			fp->async_len = 0U;
+			return result;
+		}
+		fp->async_len = length_read;
+		return 0;
+	}
+
+	/* Assert that file position is valid for this read operation */
+	pos_after = fp->file_pos + length;
+	assert((pos_after >= fp->file_pos) && (pos_after <= fp->size));
+	(void)pos_after;
+
+	fp->async_len = length;
+
+	result = spec->copy_start(buffer,
+				  (uintptr_t)(fp->base + fp->file_pos), length);
+	if (result != 0) {
+		fp->async_len = 0U;
+	}
+
+	return result;
+}
+
+
+/* Poll an asynchronous read on the memmap device */
+static int memmap_block_read_poll(io_entity_t *entity, size_t *length_read)
+{
+	const io_memmap_dev_spec_t *spec;
+	memmap_file_state_t *fp;
+	int result;
+
+	assert(entity != NULL);
+	assert(length_read != NULL);
+
+	spec = (const io_memmap_dev_spec_t *)entity->dev_handle->info;
+	fp = (memmap_file_state_t *) entity->info;
+
+	if ((spec == NULL) || (spec->copy_start == NULL)) {
+		/* Completed by memmap_block_read_async() */
+		*length_read = fp->async_len;
+		fp->async_len = 0U;
+		return 0;
+	}
+
+	result = spec->copy_poll();
+	if (result == -EINPROGRESS) {
+		return result;
+	}
+
+	if (result == 0) {
+		fp->file_pos += fp->async_len;
+		*length_read = fp->async_len;
+	}
+	fp->async_len = 0U;
+
+	return result;
+}
+
+
 /* Write data to a file on the memmap device */
 static int memmap_block_write(io_entity_t *entity, const uintptr_t buffer,
 			      size_t length, size_t *length_written)
@@ -5,6 +5,8 @@
  */
 
 #include <assert.h>
+#include <errno.h>
+#include <stdbool.h>
 #include <stddef.h>
 
 #include <platform_def.h>
@@ -22,6 +24,16 @@ static io_entity_t *entity_map[MAX_IO_HANDLES];
 /* Track number of allocated entities */
 static unsigned int entity_count;
 
+/*
+ * Result of asynchronous reads on devices without asynchronous support,
+ * which are completed when started.
+ */
+static struct {
+	bool pending;
+	int result;
+	size_t length;
+} sync_read_pool[MAX_IO_HANDLES];
+
 /* Array of fixed maximum of registered devices, definable by platform */
 static const io_dev_info_t *devices[MAX_IO_DEVICES];
 
@@ -131,6 +143,7 @@ static int free_entity(const io_entity_t *entity)
 
 	result = find_first_entity(entity, &index);
 	if (result ==  0) {
+		sync_read_pool[index].pending = false;
 		entity_map[index] = NULL;
 		--entity_count;
 	}
@@ -326,3 +339,64 @@ int io_close(uintptr_t handle)
 
 	return result;
 }
+
+
+/* Asynchronous operations */
+
+
+/* Start reading data from an IO entity */
+int io_read_async(uintptr_t handle, uintptr_t buffer, size_t length)
+{
+	int result;
+	unsigned int index = 0U;
+	assert(is_valid_entity(handle));
+
+	io_entity_t *entity = (io_entity_t *)handle;
+
+	io_dev_info_t *dev = entity->dev_handle;
+
+	if (dev->funcs->read_async != NULL) {
+		return dev->funcs->read_async(entity, buffer, length);
+	}
+
+	/* No device support, complete the read now */
+	result = find_first_entity(entity, &index);
+	assert(result == 0);
+	assert(!sync_read_pool[index].pending);
+
+	sync_read_pool[index].length = 0U;
+	sync_read_pool[index].result = io_read(handle, buffer, length,
+					       &sync_read_pool[index].length);
+	sync_read_pool[index].pending = true;
+
+	return result;
+}
+
+
+/* Poll for completion of a read started by io_read_async() */
+int io_read_poll(uintptr_t handle, size_t *length_read)
+{
+	int result;
+	unsigned int index = 0U;
+	assert(is_valid_entity(handle) && (length_read != NULL));
+
+	io_entity_t *entity = (io_entity_t *)handle;
+
+	io_dev_info_t *dev = entity->dev_handle;
+
+	if (dev->funcs->read_poll != NULL) {
+		return dev->funcs->read_poll(entity, length_read);
+	}
+
+	result = find_first_entity(entity, &index);
+	assert(result == 0);
+
+	if (!sync_read_pool[index].pending) {
+		return -EINVAL;
+	}
+
+	sync_read_pool[index].pending = false;
+	*length_read = sync_read_pool[index].length;
+
+	return sync_read_pool[index].result;
+}
@@ -50,6 +50,17 @@ static struct hash_state {
 	bool		   inuse;
 } sha_hash_state;
 
+/* Hash calculated while an image was loaded, see sha_load_start() */
+#define LOAD_HASH_TYPE	SHA_MR_ALGO_SHA256
+
+static struct load_hash_state {
+	struct hash_state *st;
+	uintptr_t	   data;
+	size_t		   len;
+	bool		   valid;
+	uint8_t		   hash[MAX_HASH_LEN];
+} sha_load_hash;
+
 static const hash_info_t *sha_get_info(lan966x_sha_type_t algo)
 {
 	if (algo < ARRAY_SIZE(hashes))
@@ -230,6 +241,25 @@ static int _sha_finish(struct hash_state *st, const void *out_hash)
 	return 0;
 }
 
+/* Return (and consume) the hash calculated while loading, if it matches */
+static int sha_get_load_hash(const void *data, size_t len, lan966x_sha_type_t hash_type,
+			     void *hash, size_t hash_len)
+{
+	struct load_hash_state *lh = &sha_load_hash;
+
+	if (lh->valid &&
+	    lh->data == (uintptr_t) data &&
+	    lh->len == len &&
+	    hash_type == LOAD_HASH_TYPE &&
+	    hashes[LOAD_HASH_TYPE].hash_len <= hash_len) {
+		memcpy(hash, lh->hash, hashes[LOAD_HASH_TYPE].hash_len);
+		lh->valid = false;
+		return 0;
+	}
+
+	return -1;
+}
+
 int sha_calc(lan966x_sha_type_t hash_type, const void *input, size_t len, void *hash, size_t hash_len)
 {
 	const hash_info_t *hinfo = sha_get_info(hash_type);
@@ -238,7 +268,8 @@ int sha_calc(lan966x_sha_type_t hash_type, const void *input, size_t len, void *
 		return -1;
 
 	/* Do we have this pre-calculated from pipelined read? */
-	if (xdmac_qspi_get_sha(input, len, hash_type, hash, hinfo->hash_len) == 0) {
+	if (xdmac_qspi_get_sha(input, len, hash_type, hash, hinfo->hash_len) == 0 ||
+	    sha_get_load_hash(input, len, hash_type, hash, hinfo->hash_len) == 0) {
 		/* Yes - use pre-calculated SHA */
 		return 0;
 	}
@@ -258,8 +289,9 @@ int sha_verify(lan966x_sha_type_t hash_type, const void *input, size_t len, cons
 	if (hinfo == NULL || hash_len < hinfo->hash_len)
 		return -1;
 
-	if (xdmac_qspi_get_sha(input, len, hash_type, cached_hash, hinfo->hash_len) == 0) {
-		/* Got cached SHA from QSPI/DMA */
+	if (xdmac_qspi_get_sha(input, len, hash_type, cached_hash, hinfo->hash_len) == 0 ||
+	    sha_get_load_hash(input, len, hash_type, cached_hash, hinfo->hash_len) == 0) {
+		/* Got cached SHA from QSPI/DMA or streamed load */
 		return memcmp(hash, cached_hash, hinfo->hash_len) == 0 ?
 			CRYPTO_SUCCESS : CRYPTO_ERR_SIGNATURE;
 	}
@@ -290,3 +322,70 @@ int sha_calc_finish(void *state, void *hash)
 {
 	return _sha_finish(state, hash);
 }
+
+/*
+ * Streamed hashing of an image while it is being loaded. The resulting
+ * hash is used by sha_calc()/sha_verify() for the same data, instead of
+ * hashing the data again.
+ */
+int sha_load_start(const void *data, size_t len)
+{
+	struct load_hash_state *lh = &sha_load_hash;
+
+	lh->valid = false;
+	lh->st = sha_calc_init(LOAD_HASH_TYPE, len, hashes[LOAD_HASH_TYPE].hash_len);
+	if (lh->st == NULL)
+		return -1;
+
+	lh->data = (uintptr_t) data;
+	lh->len = len;
+
+	return 0;
+}
+
+void sha_load_update(const void *input, size_t len)
+{
+	struct load_hash_state *lh = &sha_load_hash;
+
+	assert(lh->st != NULL);
+	_sha_update(lh->st, input, len);
+}
+
+void sha_load_finish(bool success)
+{
+	struct load_hash_state *lh = &sha_load_hash;
+
+	assert(lh->st != NULL);
+	(void) _sha_finish(lh->st, lh->hash);
+	lh->st = NULL;
+	lh->valid = success;
+}
+
+void sha_load_invalidate(void)
+{
+	sha_load_hash.valid = false;
+}
+
+/*
+ * Copy an image with the XDMAC, hashing it on the way. The hash is kept
+ * as the streamed load hash, exactly as if sha_load_start(),
+ * sha_load_update() and sha_load_finish() had been used.
+ */
+int sha_load_copy(void *dst, const void *src, size_t len, int periph)
+{
+	struct load_hash_state *lh = &sha_load_hash;
+
+	if (sha_load_start(dst, len) != 0)
+		return -1;
+
+	if (lh->st->dma) {
+		xdmac_memcpy_sha(dst, src, len, periph);
+	} else {
+		xdmac_memcpy(dst, src, len, XDMA_DIR_MEM_TO_MEM, periph);
+		_sha_update(lh->st, dst, len);
+	}
+
+	sha_load_finish(true);
+
+	return 0;
+}
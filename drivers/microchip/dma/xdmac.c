@@ -32,6 +32,14 @@ static uintptr_t base = LAN969X_XDMAC_BASE;
 
 #define MAX_CHANNEL	16U
 
+/* Channel used by xdmac_memcpy_start(), kept clear of the pipeline */
+#define ASYNC_CHANNEL	4
+
+/* Channels and block size used by xdmac_memcpy_sha() */
+#define SHA_COPY_CHANNEL	0
+#define SHA_FEED_CHANNEL	3
+#define SHA_COPY_BLOCK_SIZE	SIZE_K(16U)
+
 static inline int xdmac_compute_cc(int dir, int periph)
 {
 	int cc = 0;
@@ -235,6 +243,84 @@ void xdmac_memcpy(void *dst, const void *src, size_t len, int dir, int periph)
 	_xdmac_memcpy(0, dst, src, len, dir, periph);
 }
 
+/*
+ * Start a copy on the async channel without waiting for it to complete,
+ * xdmac_memcpy_poll() must be called until it does.
+ */
+int xdmac_memcpy_start(void *dst, const void *src, size_t len, int dir, int periph)
+{
+	struct xdmac_req req;
+
+	if (len > AT_XDMAC_MBR_UBC_UBLEN_MAX)
+		return -EINVAL;
+
+	xdmac_make_req(&req, ASYNC_CHANNEL, dir, periph, (uintptr_t) dst, (uintptr_t) src, len);
+	xdmac_start(xdmac_setup_req(&req));
+
+	return 0;
+}
+
+/* Returns -EINPROGRESS while the async channel is busy */
+int xdmac_memcpy_poll(void)
+{
+	uint32_t w;
+
+	if (mmio_read_32(XDMAC_XDMAC_GS(base)) & BIT(ASYNC_CHANNEL))
+		return -EINPROGRESS;
+
+	w = mmio_read_32(XDMAC_XDMAC_CIS_CH0(CH_OFF(base, ASYNC_CHANNEL)));
+	if (w & AT_XDMAC_CIS_BIS)
+		return 0;
+
+	ERROR("XDMAC(%d): Transfer error: %08x\n", ASYNC_CHANNEL, w);
+	return -EIO;
+}
+
+/*
+ * Copy 'len' bytes from 'src' to 'dst' and feed the copy to the SHA engine,
+ * which must have been set up for DMA input. Each block is hashed from
+ * 'dst' while the next one is being copied, so 'src' is only read once.
+ */
+void xdmac_memcpy_sha(void *dst, const void *src, size_t len, int periph)
+{
+	struct xdmac_req copy, sha;
+	size_t copied = 0, hashed = 0;
+
+	xdmac_make_req(&copy, SHA_COPY_CHANNEL, XDMA_DIR_MEM_TO_MEM, periph,
+		       (uintptr_t) dst, (uintptr_t) src, len);
+	xdmac_make_req(&sha, SHA_FEED_CHANNEL, XDMA_DIR_MEM_TO_DEV, XDMA_SHA_TX,
+		       SHA_SHA_IDATAR0(LAN966X_SHA_BASE), (uintptr_t) dst, len);
+
+	while (hashed < len) {
+		uint32_t channel_list = 0;
+
+		/* Copy the next block */
+		if (copied < len) {
+			copy.len = MIN((size_t) SHA_COPY_BLOCK_SIZE, len - copied);
+			channel_list |= xdmac_setup_req(&copy);
+		}
+
+		/* Hash the block copied in the previous round */
+		if (hashed < copied) {
+			sha.len = copied - hashed;
+			channel_list |= xdmac_setup_req(&sha);
+		}
+
+		xdmac_execute_xfers(channel_list);
+
+		if (channel_list & BIT(copy.ch)) {
+			copied += copy.len;
+			copy.dst += copy.len;
+			copy.src += copy.len;
+		}
+
+		if (channel_list & BIT(sha.ch)) {
+			hashed += sha.len;
+			sha.src += sha.len;
+		}
+	}
+}
+
 void xdmac_show_version(void)
 {
 	uint32_t w = mmio_read_32(XDMAC_XDMAC_VERSION(base));
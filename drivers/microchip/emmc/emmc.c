@@ -6,6 +6,7 @@
 
 #include <stddef.h>
 #include <assert.h>
+#include <errno.h>
 
 #include <drivers/delay_timer.h>
 #include <drivers/microchip/emmc.h>
@@ -18,7 +19,18 @@ static card p_card;
 static uintptr_t reg_base;
 static uint16_t eistr = 0u;	/* Holds the error interrupt status */
 static lan966x_mmc_params_t lan966x_params;
-static bool use_dma;
+static bool use_dma, use_adma;
+
+#if !defined(IMAGE_BL1)
+/*
+ * ADMA2 descriptor table. One transfer may move up to
+ * EMMC_ADMA_DESC_COUNT * ADMA2_DESC_MAX_LEN bytes, larger ones use SDMA.
+ */
+#ifndef EMMC_ADMA_DESC_COUNT
+#define EMMC_ADMA_DESC_COUNT	256U
+#endif
+static adma2_desc_t adma_table[EMMC_ADMA_DESC_COUNT] __aligned(ADMA2_ADDR_ALIGN);
+#endif
 
 static const unsigned int TAAC_TimeExp[8] =
 	{ 1, 10, 100, 1000, 10000, 100000, 1000000, 10000000 };
@@ -252,6 +264,11 @@ static void lan966x_mmc_initialize(void)
 		ERROR("MMC host initialization failed !\n");
 		panic();
 	}
+
+#if !defined(IMAGE_BL1)
+	use_adma = use_dma &&
+		(sdhci_read_32(reg_base, SDMMC_CA0R) & SDMMC_CA0R_ADMA2SUP) != 0;
+#endif
 }
 
 static void lan966x_get_cid_register(void)
@@ -305,58 +322,125 @@ static void lan966x_get_csd_register(void)
 	}
 }
 
-static unsigned char lan966x_emmc_poll(unsigned int expected)
+/*
+ * Check the interrupt status once. Returns 0 when an expected flag is
+ * set, -EIO on errors and -EINPROGRESS otherwise.
+ */
+static int lan966x_emmc_check(unsigned int expected)
 {
-	uint64_t timeout = timeout_init_us(EMMC_POLLING_TIMEOUT);
-	uint16_t nistr = 0u;
-
-	eistr = 0u;
-	do {
-		nistr = sdhci_read_16(reg_base, SDMMC_NISTR);
-
-		/* Check errors */
-		if (nistr & SDMMC_NISTR_ERRINT) {
-			eistr = sdhci_read_16(reg_base, SDMMC_EISTR);
+	uint16_t nistr = sdhci_read_16(reg_base, SDMMC_NISTR);
+
+	/* Check errors */
+	if (nistr & SDMMC_NISTR_ERRINT) {
+		eistr = sdhci_read_16(reg_base, SDMMC_EISTR);
+
+		/* Dump interrupt status values and variables */
+		ERROR(" NISTR: 0x%x \n", nistr);
+		ERROR(" NISTR expected: 0x%x \n", expected);
+		ERROR(" EISTR: 0x%x \n", eistr);
+		if (eistr & SDMMC_EISTR_ADMA)
+			ERROR(" AESR: 0x%x \n", sdhci_read_8(reg_base, SDMMC_AESR));
+
+		/* Clear Normal/Error Interrupt Status Register flags */
+		sdhci_write_16(reg_base, SDMMC_EISTR, eistr);
+		sdhci_write_16(reg_base, SDMMC_NISTR, nistr);
+		return -EIO;
+	}
 
-			/* Dump interrupt status values and variables */
-			ERROR(" NISTR: 0x%x \n", nistr);
-			ERROR(" NISTR expected: 0x%x \n", expected);
-			ERROR(" EISTR: 0x%x \n", eistr);
+	/* May need to DMA across boundaries */
+	if (nistr & SDMMC_NISTR_DMAINT) {
+		uint32_t buf;
 
-			/* Clear Normal/Error Interrupt Status Register flags */
-			sdhci_write_16(reg_base, SDMMC_EISTR, eistr);
-			sdhci_write_16(reg_base, SDMMC_NISTR, nistr);
-			return 1;
-		}
+		/* Ack DMAINT */
+		sdhci_write_16(reg_base, SDMMC_NISTR, SDMMC_NISTR_DMAINT);
 
-		/* May need to DMA across boundaries */
-		if (nistr & SDMMC_NISTR_DMAINT) {
-			uint32_t buf;
+		/* SSAR is updated to next DMA address */
+		buf = sdhci_read_32(reg_base, SDMMC_SSAR);
+		VERBOSE("MMC: DMA irq @ %08x\n", buf);
+		/* Writing register restarts DMA */
+		sdhci_write_32(reg_base, SDMMC_SSAR, buf);
+	}
 
-			/* Ack DMAINT */
-			sdhci_write_16(reg_base, SDMMC_NISTR, SDMMC_NISTR_DMAINT);
+	/* Wait for any expected flags */
+	if (nistr & expected) {
+		/* Clear only expected flags */
+		sdhci_write_16(reg_base, SDMMC_NISTR, expected);
+		return 0;
+	}
 
-			/* SSAR is updated to next DMA address */
-			buf = sdhci_read_32(reg_base, SDMMC_SSAR);
-			VERBOSE("MMC: DMA irq @ %08x\n", buf);
-			/* Writing register restarts DMA */
-			sdhci_write_32(reg_base, SDMMC_SSAR, buf);
-		}
+	return -EINPROGRESS;
+}
 
-		/* Wait for any expected flags */
-		if (nistr & expected) {
-			/* Clear only expected flags */
-			sdhci_write_16(reg_base, SDMMC_NISTR, expected);
-			return 0;
-		}
+static unsigned char lan966x_emmc_poll_timeout(unsigned int expected, unsigned int timeout_us)
+{
+	uint64_t timeout = timeout_init_us(timeout_us);
+	int ret;
 
+	eistr = 0u;
+	do {
+		ret = lan966x_emmc_check(expected);
+		if (ret != -EINPROGRESS)
+			return ret != 0;
 	} while(!timeout_elapsed(timeout));
 
-	ERROR("MMC: Timeout waiting for %08x - have %08x\n", expected, nistr);
+	ERROR("MMC: Timeout waiting for %08x - have %08x\n", expected,
+	      sdhci_read_16(reg_base, SDMMC_NISTR));
 
 	return 1;
 }
 
+static unsigned char lan966x_emmc_poll(unsigned int expected)
+{
+	return lan966x_emmc_poll_timeout(expected, EMMC_POLLING_TIMEOUT);
+}
+
+/* Allow for slow cards when waiting for a large transfer to complete */
+static unsigned int lan966x_xfer_timeout(size_t size)
+{
+	return EMMC_POLLING_TIMEOUT + (size >> 20) * EMMC_XFER_TIMEOUT_PER_MB;
+}
+
+static unsigned char lan966x_emmc_poll_xfer(size_t size)
+{
+	return lan966x_emmc_poll_timeout(SDMMC_NISTR_TRFC, lan966x_xfer_timeout(size));
+}
+
+#if !defined(IMAGE_BL1)
+/*
+ * Describe the buffer in the ADMA2 table, so the whole transfer is done
+ * by a single command. Returns false if it does not fit the table.
+ */
+static bool lan966x_adma_setup(uintptr_t buf, size_t size)
+{
+	size_t i, len;
+
+	if ((buf % ADMA2_ADDR_ALIGN) != 0 ||
+	    size > (EMMC_ADMA_DESC_COUNT * ADMA2_DESC_MAX_LEN))
+		return false;
+
+	for (i = 0; size > 0; i++) {
+		len = MIN(size, (size_t) ADMA2_DESC_MAX_LEN);
+		adma_table[i].attr = ADMA2_ATTR_VALID | ADMA2_ATTR_ACT_TRAN;
+		adma_table[i].len = len;
+		adma_table[i].addr = buf;
+		buf += len;
+		size -= len;
+	}
+	adma_table[i - 1].attr |= ADMA2_ATTR_END;
+
+	/* The controller reads the table from memory */
+	flush_dcache_range((uintptr_t) adma_table, i * sizeof(adma_table[0]));
+	sdhci_write_32(reg_base, SDMMC_ASAR0, (uintptr_t) adma_table);
+
+	return true;
+}
+#else
+static bool lan966x_adma_setup(uintptr_t buf, size_t size)
+{
+	return false;
+}
+#endif
+
 static void lan966x_set_data_timeout(unsigned int trans_type)
 {
 	unsigned timeout_freq;
@@ -744,7 +828,7 @@ static int lan966x_mmc_set_ios(unsigned int clock, unsigned int width)
 
 	NOTICE("MMC: %d MHz, %s, %s\n",
 	       clock / 1000000U, width_codes[width],
-	       use_dma ? "SDMA" : "No DMA");
+	       use_adma ? "ADMA2" : use_dma ? "SDMA" : "No DMA");
 
 	if (lan966x_set_clk_freq(clock, SDMMC_CLK_CTRL_PROG_MODE)) {
 		return -1;
@@ -782,7 +866,14 @@ static int lan966x_mmc_prepare(int lba, uintptr_t buf, size_t size, bool is_writ
 
 	if (use_dma) {
 		mode |= SDMMC_TMR_DMAEN;
-		sdhci_write_32(reg_base, SDMMC_SSAR, buf);
+		if (use_adma && lan966x_adma_setup(buf, size)) {
+			mmc_clrsetbits_8(reg_base, SDMMC_HC1R, SDMMC_HC1R_DMASEL_Msk,
+					 SDMMC_HC1R_DMASEL_ADMA32);
+		} else {
+			mmc_clrsetbits_8(reg_base, SDMMC_HC1R, SDMMC_HC1R_DMASEL_Msk,
+					 SDMMC_HC1R_DMASEL_SDMA);
+			sdhci_write_32(reg_base, SDMMC_SSAR, buf);
+		}
 		if (is_write) {
 			/* Flush cache -> memory */
 			flush_dcache_range(buf, size);
@@ -800,6 +891,8 @@ static int lan966x_mmc_prepare(int lba, uintptr_t buf, size_t size, bool is_writ
 
 static int lan966x_mmc_read(int lba, uintptr_t buf, size_t size)
 {
+	size_t xfer_size = size;
+
 	VERBOSE("MMC: read - lba %08x, buf %08lx, size %zd\n", lba, buf, size);
 
 	if (!SD_CARD_STATUS_SUCCESS(sdhci_read_32(reg_base, SDMMC_RR0))) {
@@ -829,7 +922,7 @@ static int lan966x_mmc_read(int lba, uintptr_t buf, size_t size)
 
 	}
 
-	if (lan966x_emmc_poll(SDMMC_NISTR_TRFC)) {
+	if (lan966x_emmc_poll_xfer(xfer_size)) {
 		lan966x_recover_error(eistr);
 		return 1;
 	}
@@ -837,8 +930,50 @@ static int lan966x_mmc_read(int lba, uintptr_t buf, size_t size)
 	return 0;
 }
 
+/*
+ * Check a DMA read whose command has been sent. The first call starts
+ * the transfer timeout, PIO reads are completed right away.
+ */
+static int lan966x_mmc_read_poll(int lba, uintptr_t buf, size_t size)
+{
+	static uint64_t timeout;
+	static bool polling;
+	int ret;
+
+	if (!use_dma)
+		return lan966x_mmc_read(lba, buf, size) ? -EIO : 0;
+
+	if (!polling) {
+		if (!SD_CARD_STATUS_SUCCESS(sdhci_read_32(reg_base, SDMMC_RR0))) {
+			ERROR("Error on CMD8 command : SD Card Status = 0x%x\n",
+			      sdhci_read_32(reg_base, SDMMC_RR0));
+			return -EIO;
+		}
+		eistr = 0u;
+		timeout = timeout_init_us(lan966x_xfer_timeout(size));
+		polling = true;
+	}
+
+	ret = lan966x_emmc_check(SDMMC_NISTR_TRFC);
+	if (ret == -EINPROGRESS) {
+		if (!timeout_elapsed(timeout))
+			return ret;
+		ERROR("MMC: Timeout waiting for %08x - have %08x\n", SDMMC_NISTR_TRFC,
+		      sdhci_read_16(reg_base, SDMMC_NISTR));
+		ret = -ETIMEDOUT;
+	}
+	polling = false;
+
+	if (ret != 0)
+		lan966x_recover_error(eistr);
+
+	return ret;
+}
+
 static int lan966x_mmc_write(int lba, uintptr_t buf, size_t size)
 {
+	size_t xfer_size = size;
+
 	VERBOSE("MMC: write - lba %08x, buf %08lx, size %zd\n", lba, buf, size);
 
 	/* Need to xfer by CPU? */
@@ -861,7 +996,7 @@ static int lan966x_mmc_write(int lba, uintptr_t buf, size_t size)
 		}
 	}
 
-	if (lan966x_emmc_poll(SDMMC_NISTR_TRFC)) {
+	if (lan966x_emmc_poll_xfer(xfer_size)) {
 		lan966x_recover_error(eistr);
 		return 1;
 	}
@@ -877,6 +1012,7 @@ static const struct mmc_ops lan966x_ops = {
 	.prepare = lan966x_mmc_prepare,
 	.read = lan966x_mmc_read,
 	.write = lan966x_mmc_write,
+	.read_poll = lan966x_mmc_read_poll,
 };
 
 void lan966x_mmc_init(lan966x_mmc_params_t * params, struct mmc_device_info *info)
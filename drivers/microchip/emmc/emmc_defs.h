@@ -14,6 +14,7 @@
 #define SDMMC_CLK_CTRL_PROG_MODE	1
 
 #define EMMC_POLLING_TIMEOUT	2000000u	/* 2sec */
+#define EMMC_XFER_TIMEOUT_PER_MB	1000000u	/* 1sec per MiB transferred */
 #define EMMC_POLLING_VALUE	10000u
 
 #define ALL_FLAGS	(0xFFFFu) /* All Irq's */
@@ -123,6 +124,9 @@
 #define   SDMMC_HC1R_DW (0x1u << 1)	/* Data Width */
 #define   SDMMC_HC1R_DW_1_BIT (0x0u << 1)	/* 1-bit mode. */
 #define   SDMMC_HC1R_DW_4_BIT (0x1u << 1)	/* 4-bit mode. */
+#define   SDMMC_HC1R_DMASEL_Msk (0x3u << 3)	/* DMA Select */
+#define   SDMMC_HC1R_DMASEL_SDMA (0x0u << 3)	/* SDMA is selected */
+#define   SDMMC_HC1R_DMASEL_ADMA32 (0x2u << 3)	/* 32-bit Address ADMA2 is selected */
 #define   SDMMC_HC1R_EXTDW (0x1u << 5)	/* Extended Data Width */
 /* -------- SDMMC_PCR : (SDMMC Offset: 0x29) Power Control Register -------- */
 #define SDMMC_PCR	0x29	/* uint8_t */
@@ -161,6 +165,7 @@
 #define SDMMC_EISTR	0x32	/* uint16_t */
 #define   SDMMC_EISTR_CMDTEO (0x1u << 0)	/* Command Timeout Error */
 #define   SDMMC_EISTR_DATTEO (0x1u << 4)	/* Data Timeout Error */
+#define   SDMMC_EISTR_ADMA (0x1u << 9)	/* ADMA Error */
 /* -------- SDMMC_NISTER : (SDMMC Offset: 0x34) Normal Interrupt Status Enable Register -------- */
 #define SDMMC_NISTER	0x34	/* uint16_t */
 #define   SDMMC_NISTER_CMDC (0x1u << 0)	/* Command Complete Status Enable */
@@ -188,7 +193,12 @@
 #define   SDMMC_CA0R_BASECLKF_Pos 8
 #define   SDMMC_CA0R_BASECLKF_Msk (0xffu << SDMMC_CA0R_BASECLKF_Pos)	/* Base Clock Frequency */
 #define   SDMMC_CA0R_ED8SUP (0x1u << 18)	/* 8-Bit Support for Embedded Device */
+#define   SDMMC_CA0R_ADMA2SUP (0x1u << 19)	/* ADMA2 Support */
 #define   SDMMC_CA0R_HSSUP (0x1u << 21)	/* High Speed Support */
+/* -------- SDMMC_AESR : (SDMMC Offset: 0x54) ADMA Error Status Register ---- */
+#define SDMMC_AESR	0x54	/* uint8_t */
+/* -------- SDMMC_ASAR0 : (SDMMC Offset: 0x58) ADMA System Address Register 0 */
+#define SDMMC_ASAR0	0x58	/* uint32_t */
 /* -------- SDMMC_MC1R : (SDMMC Offset: 0x204) e.MMC Control 1 Register ---- */
 #define SDMMC_MC1R	0x204	/* uint8_t */
 #define   SDMMC_MC1R_CMDTYP_Pos 0
@@ -291,6 +301,19 @@ typedef struct _card {
 	uint8_t card_phy_spec_rev;
 } card;
 
+/* ADMA2 descriptor, 32-bit addressing */
+typedef struct {
+	uint16_t attr;
+	uint16_t len;
+	uint32_t addr;
+} adma2_desc_t;
+
+#define ADMA2_ATTR_VALID	BIT(0)
+#define ADMA2_ATTR_END		BIT(1)
+#define ADMA2_ATTR_ACT_TRAN	(0x2u << 4)	/* Transfer data of one descriptor line */
+#define ADMA2_ADDR_ALIGN	4U
+#define ADMA2_DESC_MAX_LEN	(32U * 1024U)
+
 typedef enum {
 	SDMMC_SW_RST_ALL = 0,
 	SDMMC_SW_RST_CMD_LINE,
@@ -370,6 +393,10 @@ static const char *mmc_reg(int reg)
 		return "EISTER";
 	case SDMMC_CA0R:
 		return "CA0R";
+	case SDMMC_AESR:
+		return "AESR";
+	case SDMMC_ASAR0:
+		return "ASAR0";
 	case SDMMC_MC1R:
 		return "MC1R";
 	case SDMMC_DEBR:
@@ -433,4 +460,9 @@ static inline void mmc_setbits_8(uintptr_t addr, int reg, uint8_t set)
 	sdhci_write_8(addr, reg, sdhci_read_8(addr, reg) | set);
 }
 
+static inline void mmc_clrsetbits_8(uintptr_t addr, int reg, uint8_t clear, uint8_t set)
+{
+	sdhci_write_8(addr, reg, (sdhci_read_8(addr, reg) & ~clear) | set);
+}
+
 #endif	/* EMMC_DEFS_H */
@@ -10,6 +10,7 @@
 #include <errno.h>
 #include <fw_config.h>
 #include <lib/mmio.h>
+#include <lib/utils.h>
 #include <string.h>
 
 #include "lan966x_regs.h"
@@ -28,6 +29,26 @@ enum {
 static uint32_t otp_flags;
 #endif /* defined(MCHP_OTP_EMULATION) */
 
+/*
+ * OTP shadow: reads are served from SRAM copies of OTP_CACHE_BLOCK_SIZE
+ * byte blocks, each loaded from the device in one power cycle on first
+ * use. Blocks holding read protected bytes are remembered as such and
+ * always read from the device.
+ */
+#if !defined(OTP_CACHE_BLOCKS)
+#define OTP_CACHE_BLOCKS	16U
+#endif
+#define OTP_CACHE_BLOCK_SIZE	64U
+#define OTP_CACHE_NOCACHE	BIT(15)
+
+static struct {
+	uint8_t data[OTP_CACHE_BLOCKS][OTP_CACHE_BLOCK_SIZE];
+	uint16_t tag[OTP_CACHE_BLOCKS];	/* Block number + 1, 0 if unused */
+	unsigned int next;		/* Next slot to replace */
+} otp_cache;
+
+static struct otp_read_stats read_stats;
+
 static uintptr_t reg_base = LAN966X_OTP_BASE;
 
 static bool otp_hw_wait_flag_clear(uintptr_t reg, uint32_t flag)
@@ -102,6 +123,7 @@ static int otp_hw_read_byte(unsigned int offset, uint8_t *dst)
 {
 	int rc;
 
+	read_stats.hw_bytes++;
 	otp_hw_set_address(offset);
 	mmio_write_32(OTP_OTP_FUNC_CMD(reg_base), OTP_OTP_FUNC_CMD_OTP_READ(1));
 	mmio_write_32(OTP_OTP_CMD_GO(reg_base), OTP_OTP_CMD_GO_OTP_GO(1));
@@ -135,6 +157,85 @@ static int otp_hw_read_bytes(unsigned int offset, unsigned int nbytes, uint8_t *
 	return rc;
 }
 
+/* Get the shadow of an OTP block, loading it if needed */
+static const uint8_t *otp_cache_get_block(unsigned int block)
+{
+	unsigned int i;
+	int rc;
+
+	for (i = 0; i < OTP_CACHE_BLOCKS; i++) {
+		if ((otp_cache.tag[i] & ~OTP_CACHE_NOCACHE) == (block + 1)) {
+			if (otp_cache.tag[i] & OTP_CACHE_NOCACHE)
+				return NULL;
+			read_stats.hits++;
+			return otp_cache.data[i];
+		}
+	}
+
+	i = otp_cache.next;
+	otp_cache.next = (i + 1) % OTP_CACHE_BLOCKS;
+	otp_cache.tag[i] = 0;
+
+	read_stats.misses++;
+	rc = otp_hw_read_bytes(block * OTP_CACHE_BLOCK_SIZE,
+			       OTP_CACHE_BLOCK_SIZE, otp_cache.data[i]);
+	if (rc != 0) {
+		zeromem(otp_cache.data[i], OTP_CACHE_BLOCK_SIZE);
+		/* Don't retry protected blocks, but do retry on timeouts */
+		if (rc == -EACCES)
+			otp_cache.tag[i] = (block + 1) | OTP_CACHE_NOCACHE;
+		return NULL;
+	}
+
+	otp_cache.tag[i] = block + 1;
+	return otp_cache.data[i];
+}
+
+static int otp_cache_read_bytes(unsigned int offset, unsigned int nbytes, uint8_t *dst)
+{
+	unsigned int off, len;
+	const uint8_t *src;
+	int rc;
+
+	read_stats.reads++;
+
+	while (nbytes > 0) {
+		off = offset % OTP_CACHE_BLOCK_SIZE;
+		len = MIN(nbytes, OTP_CACHE_BLOCK_SIZE - off);
+		src = otp_cache_get_block(offset / OTP_CACHE_BLOCK_SIZE);
+		if (src != NULL) {
+			memcpy(dst, src + off, len);
+		} else {
+			rc = otp_hw_read_bytes(offset, len, dst);
+			if (rc < 0)
+				return rc;
+		}
+		offset += len;
+		nbytes -= len;
+		dst += len;
+	}
+
+	return 0;
+}
+
+/* Drop the shadow of blocks overlapping [offset, offset + nbytes) */
+static void otp_cache_invalidate(unsigned int offset, unsigned int nbytes)
+{
+	unsigned int first = offset / OTP_CACHE_BLOCK_SIZE;
+	unsigned int last = (offset + nbytes - 1) / OTP_CACHE_BLOCK_SIZE;
+	unsigned int i, block;
+
+	for (i = 0; i < OTP_CACHE_BLOCKS; i++) {
+		if (otp_cache.tag[i] == 0)
+			continue;
+		block = (otp_cache.tag[i] & ~OTP_CACHE_NOCACHE) - 1;
+		if (block >= first && block <= last) {
+			zeromem(otp_cache.data[i], OTP_CACHE_BLOCK_SIZE);
+			otp_cache.tag[i] = 0;
+		}
+	}
+}
+
 static int otp_hw_write_byte(unsigned int offset, uint8_t data)
 {
 	int rc;
@@ -190,7 +291,7 @@ void otp_emu_init(void)
 	/* Note: Now read the "ROTPK" element, to decide whether OTP
 	 * emulation has been disabled.
 	 */
-	otp_hw_read_bytes(OTP_TBBR_ROTPK_ADDR, sizeof(rotpk), rotpk);
+	otp_cache_read_bytes(OTP_TBBR_ROTPK_ADDR, sizeof(rotpk), rotpk);
 	if (otp_all_zero(rotpk, sizeof(rotpk))) {
 		otp_flags |= OTP_FLAG_EMULATION;
 	} else {
@@ -226,7 +327,7 @@ int otp_read_bytes(unsigned int offset, unsigned int nbytes, uint8_t *dst)
 	assert((offset + nbytes) < OTP_MEM_SIZE);
 
 	/* Read bitstream */
-	rc = otp_hw_read_bytes(offset, nbytes, dst);
+	rc = otp_cache_read_bytes(offset, nbytes, dst);
 
 #if defined(MCHP_OTP_EMULATION)
 	/* If we read data, possibly or in emulation data */
@@ -248,10 +349,16 @@ int otp_read_uint32(unsigned int offset, uint32_t *dst)
 
 int otp_write_bytes(unsigned int offset, unsigned int nbytes, const uint8_t *dst)
 {
+	int rc;
+
 	assert(nbytes > 0);
 	assert((offset + nbytes) < OTP_MEM_SIZE);
 
-	return otp_hw_write_bytes(offset, nbytes, dst);
+	rc = otp_hw_write_bytes(offset, nbytes, dst);
+	/* Even a failed write may have programmed some bytes */
+	otp_cache_invalidate(offset, nbytes);
+
+	return rc;
 }
 
 int otp_write_uint32(unsigned int offset, uint32_t w)
@@ -302,6 +409,7 @@ int otp_commit_emulation(void)
 			eb = ob = nb = 0; /* Don't leak */
 		}
 		otp_hw_power(false);
+		otp_cache_invalidate(0, OTP_MEM_SIZE);
 	}
 
 	return rc;
@@ -311,7 +419,21 @@ int otp_commit_emulation(void)
 /* Bl2U only - for diagnostics */
 int otp_read_bytes_raw(unsigned int offset, unsigned int nbytes, uint8_t *dst)
 {
-	return otp_hw_read_bytes(offset, nbytes, dst);
+	return otp_cache_read_bytes(offset, nbytes, dst);
+}
+
+void otp_get_read_stats(struct otp_read_stats *stats)
+{
+	*stats = read_stats;
+}
+
+void otp_cache_release(void)
+{
+	INFO("OTP: %u reads, %u blocks cached, %u hits, %u bytes read from device\n",
+		read_stats.reads, read_stats.misses, read_stats.hits,
+		read_stats.hw_bytes);
+
+	otp_cache_invalidate(0, OTP_MEM_SIZE);
 }
 
 int otp_write_regions(void)
@@ -30,6 +30,8 @@ static bool qspi_init_done;
 
 static struct spi_mem_op default_read_op;
 
+static struct qspi_write_stats write_stats;
+
 #define SST_ID			0xBFU
 
 /* QSPI register offsets */
@@ -874,7 +876,7 @@ int qspi_write_data(uint32_t offset, const void *buf, size_t len)
 	return ret;
 }
 
-int qspi_write(uint32_t offset, const void *buf, size_t len)
+static int qspi_program(uint32_t offset, const void *buf, size_t len)
 {
 	uint32_t ifr, iar;
 	int ret, ret1;
@@ -914,6 +916,86 @@ int qspi_write(uint32_t offset, const void *buf, size_t len)
 	return ret;
 }
 
+#if defined(QSPI_DELTA_WRITE)
+/*
+ * Check whether the sector at 'addr' already holds 'len' bytes of 'buf',
+ * followed by erased bytes up to the end of the sector. The sector is read
+ * back one page at a time so a difference is usually found early.
+ */
+static bool qspi_sector_matches(uint32_t addr, const uint8_t *buf, size_t len)
+{
+	static uint8_t page[WRITE_BLOCK_SIZE];
+	size_t pos, act_read, i;
+
+	for (pos = 0; pos < ERASE_BLOCK_SIZE; pos += sizeof(page)) {
+		if (qspi_read(addr + pos, (uintptr_t) page, sizeof(page), &act_read) ||
+		    act_read != sizeof(page))
+			return false;
+
+		for (i = 0; i < sizeof(page); i++) {
+			if (page[i] != ((pos + i) < len ? buf[pos + i] : 0xffU))
+				return false;
+		}
+	}
+
+	return true;
+}
+#endif
+
+int qspi_write(uint32_t offset, const void *buf, size_t len)
+{
+#if defined(QSPI_DELTA_WRITE)
+	const uint8_t *data = buf;
+	size_t pos, chunk, run = 0;
+	bool in_run = false;
+	int ret;
+
+	if (offset & (ERASE_BLOCK_SIZE-1))
+		return -EINVAL;
+
+	/* Only erase and program runs of sectors whose content differs */
+	for (pos = 0; pos < len; pos += chunk) {
+		chunk = MIN((size_t) ERASE_BLOCK_SIZE, len - pos);
+		write_stats.sectors++;
+
+		if (!qspi_sector_matches(offset + pos, data + pos, chunk)) {
+			if (!in_run) {
+				run = pos;
+				in_run = true;
+			}
+			continue;
+		}
+
+		write_stats.skipped++;
+		if (in_run) {
+			ret = qspi_program(offset + run, data + run, pos - run);
+			if (ret)
+				return ret;
+			in_run = false;
+		}
+	}
+
+	if (in_run)
+		return qspi_program(offset + run, data + run, len - run);
+
+	return 0;
+#else
+	write_stats.sectors += div_round_up(len, ERASE_BLOCK_SIZE);
+
+	return qspi_program(offset, buf, len);
+#endif
+}
+
+void qspi_get_write_stats(struct qspi_write_stats *stats)
+{
+	*stats = write_stats;
+}
+
+void qspi_clear_write_stats(void)
+{
+	write_stats = (struct qspi_write_stats) { 0 };
+}
+
 int qspi_read(unsigned int offset, uintptr_t buffer, size_t length,
 	      size_t *length_read)
 {
@@ -18,7 +18,6 @@
 #include <drivers/microchip/xdmac.h>
 #include <drivers/spi_mem.h>
 #include <drivers/spi_nor.h>
-#include <plat/microchip/common/duff_memcpy.h>
 #include <fw_config.h>
 #include <lib/libfdt/libfdt.h>
 #include <lib/mmio.h>
@@ -28,6 +27,9 @@
 #define MHZ	1000000U
 #define MHZ_NS	(1000U * MHZ)
 
+/* Sectors are compared one page at a time */
+#define QSPI_PAGE_SIZE		256U
+
 /* QSPI register offsets */
 #define QSPI_CR	     0x0000  /* Control Register */
 #define QSPI_MR	     0x0004  /* Mode Register */
@@ -213,6 +215,11 @@ static uintptr_t reg_base = LAN969X_QSPI_0_BASE;
 static unsigned int qspi_mode;
 static unsigned int qspi_dlycs;
 
+static struct qspi_write_stats write_stats;
+
+/* Erase size reported by spi_nor_init() */
+static unsigned int qspi_sector_size;
+
 /* Assumed worst case for 'slow' speed on ST flash */
 #define MIN_DLYCS_NS	25
 
@@ -761,7 +768,7 @@ static const struct spi_bus_ops mchp_qspi_bus_ops = {
 	.exec_op = mchp_qspi_exec_op,
 };
 
-int qspi_write(uint32_t offset, const void *buf, size_t len)
+static int qspi_program(uint32_t offset, const void *buf, size_t len)
 {
 	int ret;
 
@@ -775,6 +782,114 @@ int qspi_write(uint32_t offset, const void *buf, size_t len)
 	return ret;
 }
 
+/* Get the erase size of the flash, including any platform override */
+static int qspi_get_sector_size(void)
+{
+	unsigned long long size;
+	int ret;
+
+	if (qspi_sector_size != 0U)
+		return 0;
+
+	ret = spi_nor_init(&size, &qspi_sector_size);
+	if (ret)
+		return ret;
+
+	assert(qspi_sector_size != 0U &&
+	       (qspi_sector_size % QSPI_PAGE_SIZE) == 0U);
+
+	return 0;
+}
+
+#if defined(QSPI_DELTA_WRITE)
+/*
+ * Check whether the sector at 'addr' already holds 'len' bytes of 'buf',
+ * followed by erased bytes up to the end of the sector. The sector is read
+ * back one page at a time so a difference is usually found early.
+ */
+static bool qspi_sector_matches(uint32_t addr, const uint8_t *buf, size_t len)
+{
+	static uint8_t page[QSPI_PAGE_SIZE];
+	size_t pos, act_read, i;
+
+	for (pos = 0; pos < qspi_sector_size; pos += sizeof(page)) {
+		if (spi_nor_read(addr + pos, (uintptr_t) page, sizeof(page), &act_read) ||
+		    act_read != sizeof(page))
+			return false;
+
+		for (i = 0; i < sizeof(page); i++) {
+			if (page[i] != ((pos + i) < len ? buf[pos + i] : 0xffU))
+				return false;
+		}
+	}
+
+	return true;
+}
+#endif
+
+int qspi_write(uint32_t offset, const void *buf, size_t len)
+{
+#if defined(QSPI_DELTA_WRITE)
+	const uint8_t *data = buf;
+	size_t pos, chunk, run = 0;
+	bool in_run = false;
+	int ret;
+
+	ret = qspi_get_sector_size();
+	if (ret)
+		return ret;
+
+	if (offset & (qspi_sector_size - 1))
+		return -EINVAL;
+
+	/* Only erase and program runs of sectors whose content differs */
+	for (pos = 0; pos < len; pos += chunk) {
+		chunk = MIN((size_t) qspi_sector_size, len - pos);
+		write_stats.sectors++;
+
+		if (!qspi_sector_matches(offset + pos, data + pos, chunk)) {
+			if (!in_run) {
+				run = pos;
+				in_run = true;
+			}
+			continue;
+		}
+
+		write_stats.skipped++;
+		if (in_run) {
+			ret = qspi_program(offset + run, data + run, pos - run);
+			if (ret)
+				return ret;
+			in_run = false;
+		}
+	}
+
+	if (in_run)
+		return qspi_program(offset + run, data + run, len - run);
+
+	return 0;
+#else
+	int ret = qspi_get_sector_size();
+
+	if (ret)
+		return ret;
+
+	write_stats.sectors += div_round_up(len, qspi_sector_size);
+
+	return qspi_program(offset, buf, len);
+#endif
+}
+
+void qspi_get_write_stats(struct qspi_write_stats *stats)
+{
+	*stats = write_stats;
+}
+
+void qspi_clear_write_stats(void)
+{
+	write_stats = (struct qspi_write_stats) { 0 };
+}
+
 int qspi_read(unsigned int offset, uintptr_t buffer, size_t length,
 	      size_t *length_read)
 {
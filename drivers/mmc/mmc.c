@@ -700,19 +700,22 @@ static int mmc_enumerate(unsigned int clk, unsigned int bus_width)
 	return ret;
 }
 
-size_t mmc_read_blocks(int lba, uintptr_t buf, size_t size)
+/* Read started by mmc_read_blocks_start(), size is 0 when there is none */
+static struct {
+	int lba;
+	uintptr_t buf;
+	size_t size;
+} mmc_async_read;
+
+/* Prepare the host and send the read command */
+static int mmc_read_cmd(int lba, uintptr_t buf, size_t size)
 {
 	int ret;
 	unsigned int cmd_idx, cmd_arg;
 
-	assert((ops != NULL) &&
-	       (ops->read != NULL) &&
-	       (size != 0U) &&
-	       ((size & MMC_BLOCK_MASK) == 0U));
-
 	ret = ops->prepare(lba, buf, size, false);
 	if (ret != 0) {
-		return 0;
+		return ret;
 	}
 
 	if (is_cmd23_enabled()) {
@@ -720,7 +723,7 @@ size_t mmc_read_blocks(int lba, uintptr_t buf, size_t size)
 		ret = mmc_send_cmd(MMC_CMD(23), size / MMC_BLOCK_SIZE,
 				   MMC_RESPONSE_R1, NULL);
 		if (ret != 0) {
-			return 0;
+			return ret;
 		}
 
 		cmd_idx = MMC_CMD(18);
@@ -739,34 +742,112 @@ size_t mmc_read_blocks(int lba, uintptr_t buf, size_t size)
 		cmd_arg = lba;
 	}
 
-	ret = mmc_send_cmd(cmd_idx, cmd_arg, MMC_RESPONSE_R1, NULL);
-	if (ret != 0) {
-		return 0;
-	}
+	return mmc_send_cmd(cmd_idx, cmd_arg, MMC_RESPONSE_R1, NULL);
+}
 
-	ret = ops->read(lba, buf, size);
-	if (ret != 0) {
-		return 0;
-	}
+/* Wait for the device once the data has been transferred */
+static int mmc_read_done(size_t size)
+{
+	int ret;
 
 	/* Wait buffer empty */
 	do {
 		ret = mmc_device_state();
 		if (ret < 0) {
-			return 0;
+			return ret;
 		}
 	} while ((ret != MMC_STATE_TRAN) && (ret != MMC_STATE_DATA));
 
 	if (!is_cmd23_enabled() && (size > MMC_BLOCK_SIZE)) {
 		ret = mmc_send_cmd(MMC_CMD(12), 0, MMC_RESPONSE_R1B, NULL);
 		if (ret != 0) {
-			return 0;
+			return ret;
 		}
 	}
 
+	return 0;
+}
+
+size_t mmc_read_blocks(int lba, uintptr_t buf, size_t size)
+{
+	assert((ops != NULL) &&
+	       (ops->read != NULL) &&
+	       (size != 0U) &&
+	       ((size & MMC_BLOCK_MASK) == 0U));
+	assert(mmc_async_read.size == 0U);
+
+	if (mmc_read_cmd(lba, buf, size) != 0) {
+		return 0;
+	}
+
+	if (ops->read(lba, buf, size) != 0) {
+		return 0;
+	}
+
+	if (mmc_read_done(size) != 0) {
+		return 0;
+	}
+
 	return size;
 }
 
+/*
+ * Start reading blocks and return without waiting for the data. The read
+ * must be completed by mmc_read_blocks_poll() before the card is accessed
+ * again. Returns -ENOTSUP if the host driver cannot poll a read.
+ */
+int mmc_read_blocks_start(int lba, uintptr_t buf, size_t size)
+{
+	int ret;
+
+	assert((ops != NULL) &&
+	       (size != 0U) &&
+	       ((size & MMC_BLOCK_MASK) == 0U));
+	assert(mmc_async_read.size == 0U);
+
+	if (ops->read_poll == NULL) {
+		return -ENOTSUP;
+	}
+
+	ret = mmc_read_cmd(lba, buf, size);
+	if (ret != 0) {
+		return ret;
+	}
+
+	mmc_async_read.lba = lba;
+	mmc_async_read.buf = buf;
+	mmc_async_read.size = size;
+
+	return 0;
+}
+
+/*
+ * Poll a read started by mmc_read_blocks_start(). Returns -EINPROGRESS
+ * until the data has been transferred, then the result of the read and
+ * the number of bytes read in 'size'.
+ */
+int mmc_read_blocks_poll(size_t *size)
+{
+	int ret;
+
+	assert(mmc_async_read.size != 0U);
+
+	ret = ops->read_poll(mmc_async_read.lba, mmc_async_read.buf,
+			     mmc_async_read.size);
+	if (ret == -EINPROGRESS) {
+		return ret;
+	}
+
+	if (ret == 0) {
+		ret = mmc_read_done(mmc_async_read.size);
+	}
+
+	*size = (ret == 0) ? mmc_async_read.size : 0U;
+	mmc_async_read.size = 0U;
+
+	return ret;
+}
+
 size_t mmc_write_blocks(int lba, const uintptr_t buf, size_t size)
 {
 	int ret;
@@ -6,6 +6,7 @@
 
 #include <assert.h>
 #include <errno.h>
+#include <stdbool.h>
 #include <stddef.h>
 
 #include <common/debug.h>
@@ -20,6 +21,24 @@
  */
 static struct nand_device nand_dev;
 
+/*
+ * Bad block table: two bits per block, filled in as blocks are first
+ * checked, so each block marker is only read once per boot whatever the
+ * number of io_mtd opens and seeks. Blocks beyond the platform buffer are
+ * checked on the device every time.
+ */
+#define NAND_BBT_CHECKED	BIT(0)
+#define NAND_BBT_BAD		BIT(1)
+#define NAND_BBT_BLOCK_BITS	2U
+#define NAND_BBT_BLOCKS_PER_BYTE	(8U / NAND_BBT_BLOCK_BITS)
+
+static uint8_t *nand_bbt;
+static unsigned int nand_bbt_blocks;
+static bool nand_bbt_init_done;
+
+/* Time spent reading bad block markers, in delay timer counts */
+static uint64_t nand_bb_scan_cnt;
+
 #pragma weak plat_get_scratch_buffer
 void plat_get_scratch_buffer(void **buffer_addr, size_t *buf_size)
 {
@@ -32,6 +51,86 @@ void plat_get_scratch_buffer(void **buffer_addr, size_t *buf_size)
 	*buf_size = sizeof(scratch_buff);
 }
 
+#pragma weak plat_get_bbt_buffer
+void plat_get_bbt_buffer(void **buffer_addr, size_t *buf_size)
+{
+#if defined(PLATFORM_MTD_MAX_BLOCKS)
+	static uint8_t bbt_buff[(PLATFORM_MTD_MAX_BLOCKS +
+				 NAND_BBT_BLOCKS_PER_BYTE - 1U) /
+				NAND_BBT_BLOCKS_PER_BYTE];
+#endif
+
+	assert(buffer_addr != NULL);
+	assert(buf_size != NULL);
+
+#if defined(PLATFORM_MTD_MAX_BLOCKS)
+	*buffer_addr = (void *)bbt_buff;
+	*buf_size = sizeof(bbt_buff);
+#else
+	*buffer_addr = NULL;
+	*buf_size = 0U;
+#endif
+}
+
+static void nand_bbt_init(void)
+{
+	size_t bbt_size;
+	unsigned long long max_block;
+
+	if (nand_bbt_init_done) {
+		return;
+	}
+
+	plat_get_bbt_buffer((void **)&nand_bbt, &bbt_size);
+
+	max_block = nand_dev.size / nand_dev.block_size;
+	nand_bbt_blocks = (unsigned int)MIN(max_block,
+		(unsigned long long)bbt_size * NAND_BBT_BLOCKS_PER_BYTE);
+	if (nand_bbt_blocks != 0U) {
+		zeromem(nand_bbt, div_round_up(nand_bbt_blocks,
+					       NAND_BBT_BLOCKS_PER_BYTE));
+	}
+
+	if (nand_bbt_blocks < max_block) {
+		VERBOSE("NAND: bad block table covers %u of %llu blocks\n",
+			nand_bbt_blocks, max_block);
+	}
+
+	nand_bbt_init_done = true;
+}
+
+static int nand_block_is_bad(unsigned int block)
+{
+	unsigned int shift = (block % NAND_BBT_BLOCKS_PER_BYTE) *
+			     NAND_BBT_BLOCK_BITS;
+	unsigned int state;
+	uint64_t start;
+	int is_bad;
+
+	nand_bbt_init();
+
+	if (block < nand_bbt_blocks) {
+		state = nand_bbt[block / NAND_BBT_BLOCKS_PER_BYTE] >> shift;
+		if ((state & NAND_BBT_CHECKED) != 0U) {
+			return ((state & NAND_BBT_BAD) != 0U) ? 1 : 0;
+		}
+	}
+
+	start = timeout_init_us(0U);
+	is_bad = nand_dev.mtd_block_is_bad(block);
+	nand_bb_scan_cnt += timeout_init_us(0U) - start;
+
+	if ((is_bad >= 0) && (block < nand_bbt_blocks)) {
+		state = NAND_BBT_CHECKED;
+		if (is_bad == 1) {
+			state |= NAND_BBT_BAD;
+		}
+		nand_bbt[block / NAND_BBT_BLOCKS_PER_BYTE] |= state << shift;
+	}
+
+	return is_bad;
+}
+
 int nand_read(unsigned int offset, uintptr_t buffer, size_t length,
 	      size_t *length_read)
 {
@@ -63,7 +162,7 @@ int nand_read(unsigned int offset, uintptr_t buffer, size_t length,
 	}
 
 	while (block <= end_block) {
-		is_bad = nand_dev.mtd_block_is_bad(block);
+		is_bad = nand_block_is_bad(block);
 		if (is_bad < 0) {
 			return is_bad;
 		}
@@ -152,7 +251,7 @@ int nand_seek_bb(uintptr_t base, unsigned int offset, size_t *extra_offset)
 			return -EIO;
 		}
 
-		is_bad = nand_dev.mtd_block_is_bad(block);
+		is_bad = nand_block_is_bad(block);
 		if (is_bad < 0) {
 			return is_bad;
 		}
@@ -174,3 +273,8 @@ struct nand_device *get_nand_device(void)
 {
 	return &nand_dev;
 }
+
+uint64_t nand_get_bb_scan_time_us(void)
+{
+	return (nand_bb_scan_cnt * 1000000ULL) / timeout_cnt_us2cnt(1000000U);
+}
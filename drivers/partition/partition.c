@@ -6,6 +6,7 @@
 
 #include <assert.h>
 #include <inttypes.h>
+#include <stdbool.h>
 #include <stdio.h>
 #include <string.h>
 
@@ -16,10 +17,36 @@
 #include <drivers/partition/partition.h>
 #include <drivers/partition/gpt.h>
 #include <drivers/partition/mbr.h>
+#include <lib/utils.h>
 #include <plat/common/platform.h>
 
+#define GPT_ENTRIES_PER_BLOCK	(PLAT_PARTITION_BLOCK_SIZE / sizeof(gpt_entry_t))
+
+/*
+ * Loaded entries are indexed by name (and by UUID) in open addressed hash
+ * tables. A slot holds the entry number plus one, zero marks a free slot.
+ */
+#define PARTITION_INDEX_SIZE	(2U * PLAT_PARTITION_MAX_ENTRIES)
+
 static uint8_t mbr_sector[PLAT_PARTITION_BLOCK_SIZE] __aligned(16);
 static partition_entry_list_t list;
+static uint8_t name_index[PARTITION_INDEX_SIZE];
+#if !defined(GPT_NO_GUID)
+static uint8_t uuid_index[PARTITION_INDEX_SIZE];
+#endif
+
+/* GPT entries not loaded yet */
+static unsigned int gpt_entries_left;
+
+#if defined(PARTITION_LAZY_LOAD)
+/*
+ * With PARTITION_LAZY_LOAD defined, only the first block of GPT entries is
+ * read by load_partition_table(). Further blocks are read when a lookup
+ * misses the entries loaded so far, from the image load_partition_table()
+ * was given. The device must not be in use by other files at that time.
+ */
+static unsigned int gpt_image_id;
+#endif
 
 #if LOG_LEVEL >= LOG_LEVEL_VERBOSE
 static void dump_entries(int num)
@@ -119,10 +146,8 @@ static int load_gpt_header(uintptr_t image_handle)
 	header.header_crc = header_crc;
 
 	/* partition numbers can't exceed PLAT_PARTITION_MAX_ENTRIES */
-	list.entry_count = header.list_num;
-	if (list.entry_count > PLAT_PARTITION_MAX_ENTRIES) {
-		list.entry_count = PLAT_PARTITION_MAX_ENTRIES;
-	}
+	gpt_entries_left = MIN(header.list_num,
+			       (unsigned int)PLAT_PARTITION_MAX_ENTRIES);
 	return 0;
 }
 
@@ -160,68 +185,189 @@ static int load_mbr_entry(uintptr_t image_handle, mbr_entry_t *mbr_entry,
 	return 0;
 }
 
+/* FNV-1a, over at most len bytes of a NUL terminated name or a UUID */
+static unsigned int partition_hash(const uint8_t *key, size_t len, bool str)
+{
+	uint32_t hash = 2166136261U;
+	size_t i;
+
+	for (i = 0U; i < len; i++) {
+		if (str && (key[i] == 0U)) {
+			break;
+		}
+		hash = (hash ^ key[i]) * 16777619U;
+	}
+
+	return hash % PARTITION_INDEX_SIZE;
+}
+
+static unsigned int name_hash(const char *name)
+{
+	return partition_hash((const uint8_t *)name, EFI_NAMELEN, true);
+}
+
+#if !defined(GPT_NO_GUID)
+static unsigned int uuid_hash(const struct efi_guid *uuid)
+{
+	return partition_hash((const uint8_t *)uuid, sizeof(*uuid), false);
+}
+#endif
+
+static void index_insert(uint8_t *index, unsigned int slot, int entry)
+{
+	while (index[slot] != 0U) {
+		slot = (slot + 1U) % PARTITION_INDEX_SIZE;
+	}
+	index[slot] = (uint8_t)(entry + 1);
+}
+
+/* Add a newly loaded entry to the list and the indexes */
+static void add_entry(void)
+{
+	int i = list.entry_count++;
+
+	index_insert(name_index, name_hash(list.list[i].name), i);
+#if !defined(GPT_NO_GUID)
+	index_insert(uuid_index, uuid_hash(&list.list[i].part_guid), i);
+#endif
+}
+
+static void reset_entries(void)
+{
+	list.entry_count = 0;
+	gpt_entries_left = 0U;
+	zeromem(name_index, sizeof(name_index));
+#if !defined(GPT_NO_GUID)
+	zeromem(uuid_index, sizeof(uuid_index));
+#endif
+}
+
 static int load_mbr_entries(uintptr_t image_handle)
 {
 	mbr_entry_t mbr_entry;
 	int i;
 
-	list.entry_count = MBR_PRIMARY_ENTRY_NUMBER;
-
-	for (i = 0; i < list.entry_count; i++) {
+	for (i = 0; i < MBR_PRIMARY_ENTRY_NUMBER; i++) {
 		load_mbr_entry(image_handle, &mbr_entry, i);
+		zeromem(&list.list[i], sizeof(list.list[i]));
 		list.list[i].start = mbr_entry.first_lba * 512;
 		list.list[i].length = mbr_entry.sector_nums * 512;
 		list.list[i].name[0] = mbr_entry.type;
+		add_entry();
 	}
 
 	return 0;
 }
 
-static int load_gpt_entry(uintptr_t image_handle, gpt_entry_t *entry)
+/*
+ * Load the next block of GPT entries. Loading stops at the first unused
+ * entry, only the valid entries loaded from the partition table are kept.
+ */
+static int load_gpt_entry_block(uintptr_t image_handle)
 {
+	const gpt_entry_t *entry;
 	size_t bytes_read;
+	unsigned int i;
 	int result;
 
-	assert(entry != NULL);
-	result = io_read(image_handle, (uintptr_t)entry, sizeof(gpt_entry_t),
-			 &bytes_read);
-	if (sizeof(gpt_entry_t) != bytes_read)
+	result = io_seek(image_handle, IO_SEEK_SET, GPT_ENTRY_OFFSET +
+			 ((signed long long)list.entry_count *
+			  (signed long long)sizeof(gpt_entry_t)));
+	if (result != 0) {
+		return result;
+	}
+	result = io_read(image_handle, (uintptr_t)&mbr_sector,
+			 PLAT_PARTITION_BLOCK_SIZE, &bytes_read);
+	if ((result != 0) || (bytes_read != PLAT_PARTITION_BLOCK_SIZE)) {
 		return -EINVAL;
-	return result;
+	}
+
+	entry = (const gpt_entry_t *)&mbr_sector;
+	for (i = 0U; (i < GPT_ENTRIES_PER_BLOCK) && (gpt_entries_left != 0U);
+	     i++) {
+		if (parse_gpt_entry((gpt_entry_t *)&entry[i],
+				    &list.list[list.entry_count]) != 0) {
+			gpt_entries_left = 0U;
+			break;
+		}
+		add_entry();
+		gpt_entries_left--;
+	}
+
+	return 0;
 }
 
 static int verify_partition_gpt(uintptr_t image_handle)
 {
-	gpt_entry_t entry;
-	int result, i;
+	int result;
 
-	for (i = 0; i < list.entry_count; i++) {
-		result = load_gpt_entry(image_handle, &entry);
-		assert(result == 0);
-		result = parse_gpt_entry(&entry, &list.list[i]);
+	do {
+		result = load_gpt_entry_block(image_handle);
 		if (result != 0) {
+			gpt_entries_left = 0U;
 			break;
 		}
-	}
-	if (i == 0) {
+#if defined(PARTITION_LAZY_LOAD)
+		/* The rest is loaded on demand */
+		break;
+#endif
+	} while (gpt_entries_left != 0U);
+
+	if (list.entry_count == 0) {
 		return -EINVAL;
 	}
-	/*
-	 * Only records the valid partition number that is loaded from
-	 * partition table.
-	 */
-	list.entry_count = i;
-	dump_entries(list.entry_count);
+
+	if (gpt_entries_left == 0U) {
+		dump_entries(list.entry_count);
+	}
 
 	return 0;
 }
 
+/*
+ * Load more GPT entries on demand. Returns false once the whole table
+ * has been loaded.
+ */
+static bool load_more_entries(void)
+{
+#if defined(PARTITION_LAZY_LOAD)
+	uintptr_t dev_handle, image_handle, image_spec = 0;
+	int result;
+
+	if (gpt_entries_left == 0U) {
+		return false;
+	}
+
+	result = plat_get_image_source(gpt_image_id, &dev_handle, &image_spec);
+	if (result == 0) {
+		result = io_open(dev_handle, image_spec, &image_handle);
+	}
+	if (result == 0) {
+		result = load_gpt_entry_block(image_handle);
+		io_close(image_handle);
+	}
+
+	if (result != 0) {
+		WARN("Failed to load partition entries (%i)\n", result);
+		gpt_entries_left = 0U;
+	} else if (gpt_entries_left == 0U) {
+		dump_entries(list.entry_count);
+	}
+
+	return true;
+#else
+	return false;
+#endif
+}
+
 int load_partition_table(unsigned int image_id)
 {
 	uintptr_t dev_handle, image_handle, image_spec = 0;
 	mbr_entry_t mbr_entry;
 	int result;
 
+	reset_entries();
+
 	result = plat_get_image_source(image_id, &dev_handle, &image_spec);
 	if (result != 0) {
 		WARN("Failed to obtain reference to image id=%u (%i)\n",
@@ -243,8 +389,9 @@ int load_partition_table(unsigned int image_id)
 	if (mbr_entry.type == PARTITION_TYPE_GPT) {
 		result = load_gpt_header(image_handle);
 		assert(result == 0);
-		result = io_seek(image_handle, IO_SEEK_SET, GPT_ENTRY_OFFSET);
-		assert(result == 0);
+#if defined(PARTITION_LAZY_LOAD)
+		gpt_image_id = image_id;
+#endif
 		result = verify_partition_gpt(image_handle);
 	} else {
 		result = load_mbr_entries(image_handle);
@@ -257,13 +404,19 @@ out:
 
 const partition_entry_t *get_partition_entry(const char *name)
 {
+	unsigned int slot;
 	int i;
 
-	for (i = 0; i < list.entry_count; i++) {
-		if (strcmp(name, list.list[i].name) == 0) {
-			return &list.list[i];
+	do {
+		for (slot = name_hash(name); name_index[slot] != 0U;
+		     slot = (slot + 1U) % PARTITION_INDEX_SIZE) {
+			i = name_index[slot] - 1;
+			if (strcmp(name, list.list[i].name) == 0) {
+				return &list.list[i];
+			}
 		}
-	}
+	} while (load_more_entries());
+
 	return NULL;
 }
 
@@ -272,6 +425,10 @@ const partition_entry_t *get_partition_entry_by_type(const uuid_t *type_uuid)
 {
 	int i;
 
+	/* Type GUIDs are not unique, the first match must be returned */
+	while (load_more_entries()) {
+	}
+
 	for (i = 0; i < list.entry_count; i++) {
 		if (guidcmp(type_uuid, &list.list[i].type_guid) == 0) {
 			return &list.list[i];
@@ -283,13 +440,19 @@ const partition_entry_t *get_partition_entry_by_type(const uuid_t *type_uuid)
 
 const partition_entry_t *get_partition_entry_by_uuid(const uuid_t *part_uuid)
 {
+	unsigned int slot;
 	int i;
 
-	for (i = 0; i < list.entry_count; i++) {
-		if (guidcmp(part_uuid, &list.list[i].part_guid) == 0) {
-			return &list.list[i];
+	do {
+		for (slot = uuid_hash((const struct efi_guid *)part_uuid);
+		     uuid_index[slot] != 0U;
+		     slot = (slot + 1U) % PARTITION_INDEX_SIZE) {
+			i = uuid_index[slot] - 1;
+			if (guidcmp(part_uuid, &list.list[i].part_guid) == 0) {
+				return &list.list[i];
+			}
 		}
-	}
+	} while (load_more_entries());
 
 	return NULL;
 }
@@ -297,6 +460,9 @@ const partition_entry_t *get_partition_entry_by_uuid(const uuid_t *part_uuid)
 
 const partition_entry_list_t *get_partition_entry_list(void)
 {
+	while (load_more_entries()) {
+	}
+
 	return &list;
 }
 
@@ -16,9 +16,24 @@ typedef int (decompressor_t)(uintptr_t *in_buf, size_t in_len,
 			     uintptr_t *out_buf, size_t out_len,
 			     uintptr_t work_buf, size_t work_len);
 
+/*
+ * Input callback of a streaming decompressor. Returns the next chunk of
+ * compressed input in *chunk / *chunk_len (zero length at end of input).
+ * The previous chunk must be fully consumed before calling it again.
+ */
+typedef int (decompressor_read_t)(void *ctx, uintptr_t *chunk,
+				  size_t *chunk_len);
+
+typedef int (stream_decompressor_t)(decompressor_read_t *read, void *ctx,
+				    uintptr_t *out_buf, size_t out_len,
+				    uintptr_t work_buf, size_t work_len);
+
 void image_decompress_init(uintptr_t buf_base, uint32_t buf_size,
 			   decompressor_t *decompressor);
+void image_decompress_init_stream(stream_decompressor_t *decompressor);
 void image_decompress_prepare(struct image_info *info);
+void image_decompress_prepare_stream(unsigned int image_id,
+				     struct image_info *info);
 int image_decompress(struct image_info *info);
 
 #endif /* IMAGE_DECOMPRESS_H */
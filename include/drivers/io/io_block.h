@@ -13,6 +13,13 @@
 typedef struct io_block_ops {
 	size_t	(*read)(int lba, uintptr_t buf, size_t size);
 	size_t	(*write)(int lba, const uintptr_t buf, size_t size);
+	/*
+	 * Optional asynchronous block read: read_start() starts reading
+	 * whole blocks, read_poll() returns -EINPROGRESS until the read has
+	 * completed and then the number of bytes read.
+	 */
+	int	(*read_start)(int lba, uintptr_t buf, size_t size);
+	int	(*read_poll)(size_t *size);
 } io_block_ops_t;
 
 typedef struct io_block_dev_spec {
@@ -24,5 +31,6 @@ typedef struct io_block_dev_spec {
 struct io_dev_connector;
 
 int register_io_dev_block(const struct io_dev_connector **dev_con);
+void io_block_get_cache_stats(unsigned int *hits, unsigned int *misses);
 
 #endif /* IO_BLOCK_H */
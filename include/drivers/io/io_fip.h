@@ -11,5 +11,7 @@ struct io_dev_connector;
 
 int register_io_dev_fip(const struct io_dev_connector **dev_con);
 int fip_dev_get_plat_toc_flag(io_dev_info_t *dev_info, uint16_t *plat_toc_flag);
+unsigned int fip_dev_get_backend_opens_saved(void);
+unsigned int fip_dev_get_toc_reads(void);
 
 #endif /* IO_FIP_H */
@@ -7,8 +7,26 @@
 #ifndef IO_MEMMAP_H
 #define IO_MEMMAP_H
 
+#include <stddef.h>
+#include <stdint.h>
+
 struct io_dev_connector;
 
+/*
+ * Optional device configuration, passed as dev_spec to io_dev_open().
+ *
+ * copy() replaces memcpy() for synchronous reads when set.
+ *
+ * copy_start()/copy_poll() is a copy engine used for asynchronous reads.
+ * copy_poll() returns -EINPROGRESS while the copy started by copy_start()
+ * is in flight, and 0 once it has completed. Either may be NULL.
+ */
+typedef struct io_memmap_dev_spec {
+	int (*copy)(uintptr_t dst, uintptr_t src, size_t len);
+	int (*copy_start)(uintptr_t dst, uintptr_t src, size_t len);
+	int (*copy_poll)(void);
+} io_memmap_dev_spec_t;
+
 int register_io_dev_memmap(const struct io_dev_connector **dev_con);
 
 #endif /* IO_MEMMAP_H */
@@ -100,4 +100,21 @@ int io_write(uintptr_t handle, const uintptr_t buffer, size_t length,
 int io_close(uintptr_t handle);
 
 
+/* Asynchronous operations */
+
+/*
+ * Start reading into a buffer. Only one read may be outstanding per
+ * entity, and the entity must not be otherwise accessed until the read
+ * has been completed by io_read_poll(). Devices without asynchronous
+ * support complete the read before io_read_async() returns.
+ */
+int io_read_async(uintptr_t handle, uintptr_t buffer, size_t length);
+
+/*
+ * Poll an outstanding read. Returns -EINPROGRESS while the read is
+ * still in flight, otherwise the result of the read.
+ */
+int io_read_poll(uintptr_t handle, size_t *length_read);
+
+
 #endif /* IO_STORAGE_H */
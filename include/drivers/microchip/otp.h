@@ -31,6 +31,27 @@ int otp_read_uint32(unsigned int offset, uint32_t *dst);
 int otp_write_uint32(unsigned int offset, uint32_t w);
 int otp_read_bytes_raw(unsigned int offset, unsigned int nbytes, uint8_t *dst);
 
+/*
+ * OTP reads are served from a shadow in SRAM, loaded in blocks on first
+ * use and invalidated by otp_write_bytes(). The counters cover all reads
+ * since boot: 'hits' and 'misses' count shadow blocks found and loaded,
+ * 'hw_bytes' counts bytes read from the device.
+ */
+struct otp_read_stats {
+	uint32_t reads;
+	uint32_t hits;
+	uint32_t misses;
+	uint32_t hw_bytes;
+};
+
+void otp_get_read_stats(struct otp_read_stats *stats);
+
+/*
+ * Wipe the shadow, which may hold keys, before handing over to a stage
+ * that must not see them.
+ */
+void otp_cache_release(void);
+
 int otp_write_regions(void);
 
 bool otp_all_zero(const uint8_t *p, size_t nbytes);
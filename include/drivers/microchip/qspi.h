@@ -13,6 +13,12 @@
 #define QSPI_DEFAULT_SPEED_MHZ	25U
 #define QSPI_HS_SPEED_MHZ	100U
 
+/* Erase sectors handled by qspi_write() */
+struct qspi_write_stats {
+	uint32_t sectors;	/* Sectors in the written ranges */
+	uint32_t skipped;	/* Sectors already holding the data */
+};
+
 int qspi_init(void);
 void qspi_reinit(void);
 int qspi_write(uint32_t offset, const void *buf, size_t len);
@@ -20,6 +26,14 @@ int qspi_read(unsigned int offset, uintptr_t buffer, size_t length,
 	      size_t *length_read);
 unsigned int qspi_get_spi_mode(void);
 
+/*
+ * Sector counts accumulated by qspi_write() since the last
+ * qspi_clear_write_stats(). With QSPI_DELTA_WRITE, sectors already
+ * holding the data are neither erased nor programmed.
+ */
+void qspi_get_write_stats(struct qspi_write_stats *stats);
+void qspi_clear_write_stats(void);
+
 /*
  * Platform can implement this to override default QSPI clock setup.
  *
@@ -7,6 +7,7 @@
 #ifndef MICROCHIP_SHA
 #define MICROCHIP_SHA
 
+#include <stdbool.h>
 #include <stddef.h>
 
 typedef enum {
@@ -25,4 +26,10 @@ void *sha_calc_init(lan966x_sha_type_t hash_type, size_t data_len, size_t hash_l
 void sha_update(void *state, const void *input, size_t len);
 int sha_calc_finish(void *state, void *hash);
 
+int sha_load_start(const void *data, size_t len);
+void sha_load_update(const void *input, size_t len);
+void sha_load_finish(bool success);
+void sha_load_invalidate(void);
+int sha_load_copy(void *dst, const void *src, size_t len, int periph);
+
 #endif  /* MICROCHIP_SHA */
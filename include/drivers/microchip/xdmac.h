@@ -70,6 +70,9 @@ struct xdmac_req {
 
 void xdmac_bzero(void *dst, size_t count);
 void xdmac_memcpy(void *dst, const void *src, size_t len, int dir, int periph);
+int xdmac_memcpy_start(void *dst, const void *src, size_t len, int dir, int periph);
+int xdmac_memcpy_poll(void);
+void xdmac_memcpy_sha(void *dst, const void *src, size_t len, int periph);
 
 #if defined(XDMAC_PIPELINE_SUPPPORT) && defined(IMAGE_BL2)
 void xdmac_qspi_pipeline_read(void *dst, const void *src, size_t len);
@@ -149,6 +149,11 @@ struct mmc_ops {
 	int (*prepare)(int lba, uintptr_t buf, size_t size, bool is_write);
 	int (*read)(int lba, uintptr_t buf, size_t size);
 	int (*write)(int lba, const uintptr_t buf, size_t size);
+	/*
+	 * Optional: check a read whose command has been sent without
+	 * waiting, return -EINPROGRESS until the data has been transferred.
+	 */
+	int (*read_poll)(int lba, uintptr_t buf, size_t size);
 };
 
 struct mmc_csd_emmc {
@@ -270,6 +275,8 @@ struct mmc_device_info {
 };
 
 size_t mmc_read_blocks(int lba, uintptr_t buf, size_t size);
+int mmc_read_blocks_start(int lba, uintptr_t buf, size_t size);
+int mmc_read_blocks_poll(size_t *size);
 size_t mmc_write_blocks(int lba, const uintptr_t buf, size_t size);
 size_t mmc_erase_blocks(int lba, size_t size);
 int mmc_part_switch_current_boot(void);
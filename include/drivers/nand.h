@@ -35,6 +35,13 @@ struct nand_device {
 
 void plat_get_scratch_buffer(void **buffer_addr, size_t *buf_size);
 
+/*
+ * Buffer holding the bad block table, 2 bits per block. It must remain
+ * valid for the whole boot. The default is a static buffer sized for
+ * PLATFORM_MTD_MAX_BLOCKS blocks if defined, or no table otherwise.
+ */
+void plat_get_bbt_buffer(void **buffer_addr, size_t *buf_size);
+
 /*
  * Read bytes from NAND device
  *
@@ -57,6 +64,13 @@ int nand_read(unsigned int offset, uintptr_t buffer, size_t length,
  */
 int nand_seek_bb(uintptr_t base, unsigned int offset, size_t *extra_offset);
 
+/*
+ * Get the time spent reading bad block markers from the device
+ *
+ * Return: Time in microseconds since boot
+ */
+uint64_t nand_get_bb_scan_time_us(void);
+
 /*
  * Get NAND device instance
  *
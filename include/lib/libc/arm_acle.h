@@ -13,12 +13,37 @@
 #ifndef ARM_ACLE_H
 #define ARM_ACLE_H
 
+#include <stdint.h>
+
 #if !defined(__aarch64__) || defined(__clang__)
 #	define __crc32b __builtin_arm_crc32b
 #	define __crc32w __builtin_arm_crc32w
+#	define __crc32cb __builtin_arm_crc32cb
+#	define __crc32cw __builtin_arm_crc32cw
 #else
 #	define __crc32b __builtin_aarch64_crc32b
 #	define __crc32w __builtin_aarch64_crc32w
+#	define __crc32cb __builtin_aarch64_crc32cb
+#	define __crc32cw __builtin_aarch64_crc32cw
+#endif
+
+#if defined(__aarch64__) && defined(__clang__)
+#	define __crc32d __builtin_arm_crc32d
+#	define __crc32cd __builtin_arm_crc32cd
+#elif defined(__aarch64__)
+#	define __crc32d __builtin_aarch64_crc32x
+#	define __crc32cd __builtin_aarch64_crc32cx
+#else
+/* AArch32 has no doubleword forms, fold in the two words */
+static inline uint32_t __crc32d(uint32_t crc, uint64_t data)
+{
+	return __crc32w(__crc32w(crc, (uint32_t)data), (uint32_t)(data >> 32));
+}
+
+static inline uint32_t __crc32cd(uint32_t crc, uint64_t data)
+{
+	return __crc32cw(__crc32cw(crc, (uint32_t)data), (uint32_t)(data >> 32));
+}
 #endif
 
 #endif	/* ARM_ACLE_H */
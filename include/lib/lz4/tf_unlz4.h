@@ -0,0 +1,20 @@
+/*
+ * Copyright (C) 2026 Microchip Technology Inc. and its subsidiaries.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef TF_UNLZ4_H
+#define TF_UNLZ4_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/* First 32-bit word (little endian) of LZ4 compressed data */
+#define LZ4_FRAME_MAGIC		0x184D2204U
+#define LZ4_LEGACY_MAGIC	0x184C2102U
+
+int unlz4(uintptr_t *in_buf, size_t in_len, uintptr_t *out_buf,
+	  size_t out_len, uintptr_t work_buf, size_t work_len);
+
+#endif /* TF_UNLZ4_H */
@@ -10,7 +10,11 @@
 #include <stddef.h>
 #include <stdint.h>
 
+#include <common/image_decompress.h>
+
 int gunzip(uintptr_t *in_buf, size_t in_len, uintptr_t *out_buf,
 	   size_t out_len, uintptr_t work_buf, size_t work_len);
+int gunzip_stream(decompressor_read_t *read, void *ctx, uintptr_t *out_buf,
+		  size_t out_len, uintptr_t work_buf, size_t work_len);
 
 #endif /* TF_GUNZIP_H */
@@ -449,5 +449,19 @@ uint32_t plat_fwu_get_boot_idx(void);
 void plat_decrypt_context_enter(const struct fw_enc_hdr *hdr,
 				const uint8_t *key, size_t key_len, unsigned int key_flags);
 void plat_decrypt_leave(void);
+int plat_decrypt_stream_start(const struct fw_enc_hdr *hdr, const uint8_t *key,
+			      size_t key_len, unsigned int key_flags,
+			      size_t data_len);
+void plat_decrypt_stream_update(uintptr_t data, size_t len);
+int plat_decrypt_stream_finish(const struct fw_enc_hdr *hdr);
+
+/*******************************************************************************
+ * MCHP Streaming hash support
+ ******************************************************************************/
+
+int plat_load_hash_start(unsigned int image_id, uintptr_t dev_handle,
+			 uintptr_t image_base, size_t image_size);
+void plat_load_hash_update(uintptr_t data, size_t len);
+void plat_load_hash_finish(int result);
 
 #endif /* PLATFORM_H */
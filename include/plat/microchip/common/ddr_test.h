@@ -14,4 +14,13 @@ uintptr_t ddr_test_data_bus(uintptr_t ddr_base_addr, bool cache);
 uintptr_t ddr_test_addr_bus(uintptr_t ddr_base_addr, size_t ddr_size, bool cache);
 uintptr_t ddr_test_rnd(uintptr_t ddr_base_addr, size_t ddr_size, bool cache, uint32_t seed);
 
+/* Bandwidth measured by ddr_test_pattern(), in MiB/s */
+struct ddr_test_bw {
+	uint32_t write_mbps;
+	uint32_t read_mbps;
+};
+
+uintptr_t ddr_test_pattern(uintptr_t ddr_base_addr, size_t ddr_size, bool cache,
+			   struct ddr_test_bw *bw);
+
 #endif /* _DDR_TEST_H */
@@ -59,6 +59,12 @@
 #define BOOTSTRAP_WRITE_READBACK    'j'
 // Get SRAM block size (for BOOTSTRAP_SEND_SRAM cmd) (BL2U)
 #define BOOTSTRAP_SRAM_INFO    's'
+// Load data file, windowed binary bulk transfer (BL2U)
+#define BOOTSTRAP_SEND_BULK    'K'
+// eMMC/SD read throughput benchmark (BL2U)
+#define BOOTSTRAP_EMMC_BENCH   'E'
+// Memory copy benchmark (BL2U)
+#define BOOTSTRAP_MEMCPY_BENCH 'M'
 // ACK
 #define BOOTSTRAP_ACK          'a'
 // NACK
@@ -79,6 +85,35 @@ typedef struct {
 
 #define BSTRAP_REQ_FLAG_BINARY	BIT(0)
 
+/*
+ * Bulk transfer (BOOTSTRAP_SEND_BULK): after the request is acknowledged
+ * with the accepted configuration, data is sent as raw binary blocks:
+ *
+ *   bstrap_bulk_hdr_t | payload | CRC32C of header and payload (LE)
+ *
+ * Up to 'window' blocks may be in flight. The device sends a cumulative
+ * ACK holding the next expected offset after each 'window' blocks and
+ * after the last one, or a NACK holding that offset when a block is lost
+ * or corrupted, after which the host resends from there. Blocks at any
+ * other offset are dropped. Without a reply the host resends from the
+ * last acknowledged offset. A block with a zero length aborts the
+ * transfer.
+ */
+#define BSTRAP_BULK_MAGIC	0x4b4c5542U	/* "BULK" */
+#define BSTRAP_BULK_BLOCK_MAX	(64U * 1024U)
+#define BSTRAP_BULK_WINDOW_MAX	64U
+
+typedef struct {
+	uint32_t block_size;		   /* Payload bytes per block */
+	uint32_t window;		   /* Blocks in flight         */
+} __packed bstrap_bulk_cfg_t;
+
+typedef struct {
+	uint32_t magic;			   /* BSTRAP_BULK_MAGIC        */
+	uint32_t offset;		   /* Payload offset           */
+	uint32_t len;			   /* Payload length           */
+} __packed bstrap_bulk_hdr_t;
+
 typedef struct {
 	uint8_t  cmd;
 	uint8_t  flags;
@@ -132,3 +167,6 @@ static inline void bootstrap_TxNack(const char *str)
 }
 
 bool bootstrap_RxDataCrc(bootstrap_req_t *req, uint8_t *data);
+
+int bootstrap_RxBulk(uint8_t *data, uint32_t length,
+		     const bstrap_bulk_cfg_t *cfg);
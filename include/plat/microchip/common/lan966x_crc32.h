@@ -7,6 +7,7 @@
 #ifndef LAN966X_CRC32_H
 #define LAN966X_CRC32_H
 
+#include <stddef.h>
 #include <stdint.h>
 
 uint32_t Crc32c(uint32_t crc, const void *data, size_t size);
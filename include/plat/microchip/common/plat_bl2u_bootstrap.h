@@ -21,6 +21,6 @@ int lan966x_bl2u_emmc_write(uint32_t offset, uintptr_t buf_ptr, uint32_t length,
 
 int lan966x_bl2u_emmc_read(uint32_t offset, uintptr_t buf_ptr, uint32_t length);
 
-int lan966x_bl2u_qspi_verify(uint32_t offset, uintptr_t buf_ptr, size_t length);
+int lan966x_bl2u_qspi_write(uint32_t offset, uintptr_t buf_ptr, uint32_t length);
 
 #endif
@@ -0,0 +1,34 @@
+/*
+ * Copyright (C) 2026 Microchip Technology Inc. and its subsidiaries.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef PLAT_MEMCPY_H
+#define PLAT_MEMCPY_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/*
+ * Copy with the CPU. The destination is aligned first, then the bulk is
+ * moved in 32 byte blocks of doublewords, or merged from aligned words of
+ * the source when it is not aligned the same way.
+ */
+void *plat_memcpy_cpu(void *dst, const void *src, size_t len);
+
+/*
+ * Copy with the XDMAC from PLAT_MEMCPY_DMA_THRESHOLD bytes upwards, and
+ * with plat_memcpy_cpu() below that. Both areas must be DMA accessible;
+ * the source may be a memory mapped flash window such as the QSPI.
+ */
+void *plat_memcpy(void *dst, const void *src, size_t len);
+
+/*
+ * Time all copy variants over a range of sizes, aligned and misaligned,
+ * using 'buf' as scratch area. Results are logged.
+ * Returns 0, -ENOMEM if 'buf' is too small or -EIO if a copy failed.
+ */
+int plat_memcpy_bench(uintptr_t buf, size_t buf_size);
+
+#endif	/* PLAT_MEMCPY_H */
@@ -8,21 +8,14 @@ LIBC_SRCS	:=	$(addprefix lib/libc/,		\
 			abort.c				\
 			assert.c			\
 			exit.c				\
-			memchr.c			\
-			memcmp.c			\
-			memcpy.c			\
-			memmove.c			\
 			memrchr.c			\
 			printf.c			\
 			putchar.c			\
 			puts.c				\
 			snprintf.c			\
 			strchr.c			\
-			strcmp.c			\
 			strlcat.c			\
 			strlcpy.c			\
-			strlen.c			\
-			strncmp.c			\
 			strnlen.c			\
 			strrchr.c			\
 			strtok.c			\
@@ -33,9 +26,24 @@ LIBC_SRCS	:=	$(addprefix lib/libc/,		\
 
 ifeq (${ARCH},aarch64)
 LIBC_SRCS	+=	$(addprefix lib/libc/aarch64/,	\
+			memchr.S			\
+			memcmp.S			\
+			memcpy.S			\
+			memmove.S			\
 			memset.S			\
-			setjmp.S)
+			setjmp.S			\
+			strcmp.S			\
+			strlen.S			\
+			strncmp.S)
 else
+LIBC_SRCS	+=	$(addprefix lib/libc/,		\
+			memchr.c			\
+			memcmp.c			\
+			memcpy.c			\
+			memmove.c			\
+			strcmp.c			\
+			strlen.c			\
+			strncmp.c)
 LIBC_SRCS	+=	$(addprefix lib/libc/aarch32/,	\
 			memset.S)
 endif
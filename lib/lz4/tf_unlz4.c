@@ -0,0 +1,350 @@
+/*
+ * Copyright (C) 2026 Microchip Technology Inc. and its subsidiaries.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <errno.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include <common/debug.h>
+#include <lib/utils_def.h>
+#include <tf_unlz4.h>
+
+/* Frame descriptor flags */
+#define LZ4F_VERSION_MASK	0xC0U
+#define LZ4F_VERSION		0x40U
+#define LZ4F_BLOCK_CHECKSUM	0x10U
+#define LZ4F_CONTENT_SIZE	0x08U
+#define LZ4F_CONTENT_CHECKSUM	0x04U
+#define LZ4F_RESERVED		0x02U
+#define LZ4F_DICT_ID		0x01U
+
+#define LZ4F_BLOCK_UNCOMPRESSED	0x80000000U
+
+#define LZ4_SKIPPABLE_MAGIC	0x184D2A50U
+#define LZ4_SKIPPABLE_MASK	0xFFFFFFF0U
+
+#define LZ4_LEGACY_BLOCK_SIZE	(8U * 1024U * 1024U)
+#define LZ4_MIN_MATCH		4U
+
+#define XXH_PRIME32_1		0x9E3779B1U
+#define XXH_PRIME32_2		0x85EBCA77U
+#define XXH_PRIME32_3		0xC2B2AE3DU
+#define XXH_PRIME32_4		0x27D4EB2FU
+#define XXH_PRIME32_5		0x165667B1U
+
+static inline uint32_t get_le32(const uint8_t *p)
+{
+	return (uint32_t)p[0] | ((uint32_t)p[1] << 8) |
+		((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static inline uint32_t rotl32(uint32_t x, unsigned int r)
+{
+	return (x << r) | (x >> (32U - r));
+}
+
+static inline uint32_t xxh32_round(uint32_t acc, uint32_t input)
+{
+	acc += input * XXH_PRIME32_2;
+	acc = rotl32(acc, 13U);
+	return acc * XXH_PRIME32_1;
+}
+
+/* XXH32, used for the frame header, block and content checksums */
+static uint32_t xxh32(const uint8_t *p, size_t len, uint32_t seed)
+{
+	const uint8_t *end = p + len;
+	uint32_t h;
+
+	if (len >= 16U) {
+		uint32_t v1 = seed + XXH_PRIME32_1 + XXH_PRIME32_2;
+		uint32_t v2 = seed + XXH_PRIME32_2;
+		uint32_t v3 = seed;
+		uint32_t v4 = seed - XXH_PRIME32_1;
+
+		do {
+			v1 = xxh32_round(v1, get_le32(p));
+			v2 = xxh32_round(v2, get_le32(p + 4));
+			v3 = xxh32_round(v3, get_le32(p + 8));
+			v4 = xxh32_round(v4, get_le32(p + 12));
+			p += 16;
+		} while (p <= (end - 16));
+
+		h = rotl32(v1, 1U) + rotl32(v2, 7U) +
+			rotl32(v3, 12U) + rotl32(v4, 18U);
+	} else {
+		h = seed + XXH_PRIME32_5;
+	}
+
+	h += (uint32_t)len;
+
+	while ((p + 4) <= end) {
+		h += get_le32(p) * XXH_PRIME32_3;
+		h = rotl32(h, 17U) * XXH_PRIME32_4;
+		p += 4;
+	}
+
+	while (p < end) {
+		h += (*p++) * XXH_PRIME32_5;
+		h = rotl32(h, 11U) * XXH_PRIME32_1;
+	}
+
+	h ^= h >> 15;
+	h *= XXH_PRIME32_2;
+	h ^= h >> 13;
+	h *= XXH_PRIME32_3;
+	h ^= h >> 16;
+
+	return h;
+}
+
+/* Read an LZ4 length extension: a run of 255 bytes plus a final byte */
+static bool lz4_get_len(const uint8_t **ip, const uint8_t *iend, size_t *len)
+{
+	uint8_t b;
+
+	do {
+		if (*ip >= iend)
+			return false;
+		b = *(*ip)++;
+		*len += b;
+	} while (b == 255U);
+
+	return true;
+}
+
+/*
+ * Decode one LZ4 block from [ip, iend) to op. Matches may refer to any
+ * data already decoded since out_start (linked blocks).
+ */
+static int lz4_decode_block(const uint8_t *ip, const uint8_t *iend,
+			    uint8_t *out_start, uint8_t **opp, uint8_t *oend)
+{
+	uint8_t *op = *opp;
+
+	while (ip < iend) {
+		const uint8_t *match;
+		unsigned int token = *ip++;
+		size_t len = token >> 4;
+		size_t offset;
+
+		/* Literals */
+		if ((len == 15U) && !lz4_get_len(&ip, iend, &len))
+			return -EIO;
+		if ((len > (size_t)(iend - ip)) || (len > (size_t)(oend - op)))
+			return -EIO;
+		memcpy(op, ip, len);
+		ip += len;
+		op += len;
+
+		/* The last sequence has no match part */
+		if (ip == iend)
+			break;
+
+		/* Match */
+		if ((iend - ip) < 2)
+			return -EIO;
+		offset = (size_t)ip[0] | ((size_t)ip[1] << 8);
+		ip += 2;
+		if ((offset == 0U) || (offset > (size_t)(op - out_start)))
+			return -EIO;
+
+		len = token & 0xFU;
+		if ((len == 15U) && !lz4_get_len(&ip, iend, &len))
+			return -EIO;
+		len += LZ4_MIN_MATCH;
+		if (len > (size_t)(oend - op))
+			return -EIO;
+
+		match = op - offset;
+		if (offset >= len) {
+			memcpy(op, match, len);
+			op += len;
+		} else {
+			/* Overlapping copy repeats the last 'offset' bytes */
+			while (len-- > 0U)
+				*op++ = *match++;
+		}
+	}
+
+	*opp = op;
+
+	return 0;
+}
+
+static int lz4_frame(const uint8_t **ipp, const uint8_t *iend,
+		     uint8_t **opp, uint8_t *oend)
+{
+	const uint8_t *ip = *ipp, *desc;
+	uint8_t *out_start = *opp, *op = *opp;
+	unsigned int flg;
+	uint32_t bsize;
+	bool stored;
+	int ret;
+
+	/* Magic, FLG, BD, [content size], HC */
+	if ((iend - ip) < 7)
+		return -EIO;
+	desc = ip + 4;
+	flg = desc[0];
+	if (((flg & LZ4F_VERSION_MASK) != LZ4F_VERSION) ||
+	    ((flg & (LZ4F_RESERVED | LZ4F_DICT_ID)) != 0U)) {
+		ERROR("lz4: unsupported frame flags %02x\n", flg);
+		return -EIO;
+	}
+	ip = desc + 2;
+	if ((flg & LZ4F_CONTENT_SIZE) != 0U) {
+		if ((iend - ip) < 9)
+			return -EIO;
+		ip += 8;
+	}
+	if (*ip != ((xxh32(desc, ip - desc, 0U) >> 8) & 0xFFU)) {
+		ERROR("lz4: frame header checksum error\n");
+		return -EIO;
+	}
+	ip++;
+
+	/* Blocks, terminated by a zero size */
+	for (;;) {
+		if ((iend - ip) < 4)
+			return -EIO;
+		bsize = get_le32(ip);
+		ip += 4;
+		if (bsize == 0U)
+			break;
+
+		stored = (bsize & LZ4F_BLOCK_UNCOMPRESSED) != 0U;
+		bsize &= ~LZ4F_BLOCK_UNCOMPRESSED;
+		if (bsize > (size_t)(iend - ip))
+			return -EIO;
+
+		/* The block checksum covers the block data as stored */
+		if ((flg & LZ4F_BLOCK_CHECKSUM) != 0U) {
+			if (((size_t)(iend - ip) - bsize) < 4U)
+				return -EIO;
+			if (get_le32(ip + bsize) != xxh32(ip, bsize, 0U)) {
+				ERROR("lz4: block checksum error\n");
+				return -EIO;
+			}
+		}
+
+		if (stored) {
+			if (bsize > (size_t)(oend - op))
+				return -EIO;
+			memcpy(op, ip, bsize);
+			op += bsize;
+		} else {
+			ret = lz4_decode_block(ip, ip + bsize, out_start,
+					       &op, oend);
+			if (ret != 0)
+				return ret;
+		}
+		ip += bsize;
+
+		if ((flg & LZ4F_BLOCK_CHECKSUM) != 0U)
+			ip += 4;
+	}
+
+	if ((flg & LZ4F_CONTENT_CHECKSUM) != 0U) {
+		if ((iend - ip) < 4)
+			return -EIO;
+		if (get_le32(ip) != xxh32(out_start, op - out_start, 0U)) {
+			ERROR("lz4: content checksum error\n");
+			return -EIO;
+		}
+		ip += 4;
+	}
+
+	*ipp = ip;
+	*opp = op;
+
+	return 0;
+}
+
+static int lz4_legacy(const uint8_t **ipp, const uint8_t *iend,
+		      uint8_t **opp, uint8_t *oend)
+{
+	const uint8_t *ip = *ipp + 4;
+	uint8_t *op = *opp;
+	uint32_t bsize;
+	int ret;
+
+	/* Blocks until the end of input or the next magic number */
+	while ((iend - ip) >= 4) {
+		bsize = get_le32(ip);
+		if ((bsize == LZ4_LEGACY_MAGIC) || (bsize == LZ4_FRAME_MAGIC))
+			break;
+		ip += 4;
+		if (bsize > (size_t)(iend - ip))
+			return -EIO;
+
+		/* Legacy blocks are independent */
+		ret = lz4_decode_block(ip, ip + bsize, op, &op,
+				       MIN(oend, op + LZ4_LEGACY_BLOCK_SIZE));
+		if (ret != 0)
+			return ret;
+		ip += bsize;
+	}
+
+	*ipp = ip;
+	*opp = op;
+
+	return 0;
+}
+
+/*
+ * unlz4 - decompress LZ4 frame (or legacy) data
+ * @in_buf: source of compressed input. Upon exit, the end of input.
+ * @in_len: length of in_buf
+ * @out_buf: destination of decompressed output. Upon exit, the end of output.
+ * @out_len: length of out_buf
+ * @work_buf: workspace (unused)
+ * @work_len: length of workspace
+ */
+int unlz4(uintptr_t *in_buf, size_t in_len, uintptr_t *out_buf,
+	  size_t out_len, uintptr_t work_buf, size_t work_len)
+{
+	const uint8_t *ip = (const uint8_t *)*in_buf;
+	const uint8_t *iend = ip + in_len;
+	uint8_t *op = (uint8_t *)*out_buf;
+	uint8_t *oend = op + out_len;
+	uint32_t magic;
+	int ret = -EIO;
+
+	/* Concatenated frames are decoded back to back */
+	while ((iend - ip) >= 4) {
+		magic = get_le32(ip);
+		if (magic == LZ4_FRAME_MAGIC) {
+			ret = lz4_frame(&ip, iend, &op, oend);
+		} else if (magic == LZ4_LEGACY_MAGIC) {
+			ret = lz4_legacy(&ip, iend, &op, oend);
+		} else if ((magic & LZ4_SKIPPABLE_MASK) == LZ4_SKIPPABLE_MAGIC) {
+			if ((iend - ip) < 8)
+				break;
+			ret = 0;
+			ip += 8;
+			if (get_le32(ip - 4) > (size_t)(iend - ip))
+				ret = -EIO;
+			else
+				ip += get_le32(ip - 4);
+		} else {
+			/* Trailing padding */
+			break;
+		}
+		if (ret != 0) {
+			ERROR("lz4: decompression failed (ret = %d)\n", ret);
+			break;
+		}
+	}
+
+	VERBOSE("lz4: %zu byte input\n", (size_t)(ip - (const uint8_t *)*in_buf));
+	VERBOSE("lz4: %zu byte output\n", (size_t)(op - (uint8_t *)*out_buf));
+
+	*in_buf = (uintptr_t)ip;
+	*out_buf = (uintptr_t)op;
+
+	return ret;
+}
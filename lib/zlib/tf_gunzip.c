@@ -102,6 +102,76 @@ int gunzip(uintptr_t *in_buf, size_t in_len, uintptr_t *out_buf,
 	return ret;
 }
 
+/*
+ * gunzip_stream - decompress gzip data pulled in chunks from a callback
+ * @read: input callback, returns the next chunk of compressed data
+ * @ctx: context passed to @read
+ * @out_buf: destination of decompressed output. Upon exit, the end of output.
+ * @out_len: length of out_buf
+ * @work_buf: workspace
+ * @work_len: length of workspace
+ */
+int gunzip_stream(decompressor_read_t *read, void *ctx, uintptr_t *out_buf,
+		  size_t out_len, uintptr_t work_buf, size_t work_len)
+{
+	z_stream stream;
+	uintptr_t chunk;
+	size_t chunk_len;
+	int zret, ret = 0;
+
+	zalloc_start = work_buf;
+	zalloc_end = work_buf + work_len;
+	zalloc_current = zalloc_start;
+
+	stream.next_in = Z_NULL;
+	stream.avail_in = 0;
+	stream.next_out = (typeof(stream.next_out))*out_buf;
+	stream.avail_out = out_len;
+	stream.zalloc = zcalloc;
+	stream.zfree = zfree;
+	stream.opaque = (voidpf)0;
+
+	zret = inflateInit(&stream);
+	if (zret != Z_OK) {
+		ERROR("zlib: inflate init failed (ret = %d)\n", zret);
+		return (zret == Z_MEM_ERROR) ? -ENOMEM : -EIO;
+	}
+
+	do {
+		if (stream.avail_in == 0U) {
+			ret = read(ctx, &chunk, &chunk_len);
+			if (ret != 0) {
+				break;
+			}
+			if (chunk_len == 0U) {
+				ERROR("zlib: input truncated\n");
+				ret = -EIO;
+				break;
+			}
+			stream.next_in = (typeof(stream.next_in))chunk;
+			stream.avail_in = chunk_len;
+		}
+
+		zret = inflate(&stream, Z_NO_FLUSH);
+	} while (zret == Z_OK);
+
+	if ((ret == 0) && (zret != Z_STREAM_END)) {
+		if (stream.msg)
+			ERROR("%s\n", stream.msg);
+		ERROR("zlib: inflate failed (ret = %d)\n", zret);
+		ret = (zret == Z_MEM_ERROR) ? -ENOMEM : -EIO;
+	}
+
+	VERBOSE("zlib: %lu byte input\n", stream.total_in);
+	VERBOSE("zlib: %lu byte output\n", stream.total_out);
+
+	*out_buf = (uintptr_t)stream.next_out;
+
+	inflateEnd(&stream);
+
+	return ret;
+}
+
 /* Wrapper function to calculate CRC
  * @crc: previous accumulated CRC
  * @buf: buffer base address
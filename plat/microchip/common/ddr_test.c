@@ -14,6 +14,9 @@
 #define DDR_PATTERN1 0xAAAAAAAAU
 #define DDR_PATTERN2 0x55555555U
 
+/* Bytes written or checked per iteration of the pattern loops */
+#define DDR_TEST_BLOCK	(8U * sizeof(uint64_t))
+
 /*******************************************************************************
  * This function tests the DDR data bus wiring.
  * This is inspired from the Data Bus Test algorithm written by Michael Barr
@@ -162,3 +165,121 @@ uintptr_t ddr_test_rnd(uintptr_t ddr_base_addr, size_t ddr_size, bool cache, uin
 
 	return 0;
 }
+
+/*
+ * Pattern of the doubleword at 'addr': the address in the low word and
+ * its complement in the high word, so every doubleword is unique and each
+ * data bit toggles across the range.
+ */
+static inline uint64_t ddr_pattern(uintptr_t addr, uint64_t inv)
+{
+	uint32_t a = (uint32_t) addr;
+
+	return (((uint64_t) ~a << 32) | a) ^ inv;
+}
+
+static void ddr_pattern_write(uintptr_t start, uintptr_t end, uint64_t inv)
+{
+	uint64_t *p;
+
+	/* Unrolled so full cache lines are written back to back */
+	for (p = (uint64_t *) start; p < (uint64_t *) end; p += 8) {
+		p[0] = ddr_pattern((uintptr_t) &p[0], inv);
+		p[1] = ddr_pattern((uintptr_t) &p[1], inv);
+		p[2] = ddr_pattern((uintptr_t) &p[2], inv);
+		p[3] = ddr_pattern((uintptr_t) &p[3], inv);
+		p[4] = ddr_pattern((uintptr_t) &p[4], inv);
+		p[5] = ddr_pattern((uintptr_t) &p[5], inv);
+		p[6] = ddr_pattern((uintptr_t) &p[6], inv);
+		p[7] = ddr_pattern((uintptr_t) &p[7], inv);
+	}
+}
+
+static uintptr_t ddr_pattern_check(uintptr_t start, uintptr_t end, uint64_t inv)
+{
+	const uint64_t *p;
+	uint64_t diff;
+	int i;
+
+	for (p = (const uint64_t *) start; p < (const uint64_t *) end; p += 8) {
+		diff = (p[0] ^ ddr_pattern((uintptr_t) &p[0], inv)) |
+			(p[1] ^ ddr_pattern((uintptr_t) &p[1], inv)) |
+			(p[2] ^ ddr_pattern((uintptr_t) &p[2], inv)) |
+			(p[3] ^ ddr_pattern((uintptr_t) &p[3], inv)) |
+			(p[4] ^ ddr_pattern((uintptr_t) &p[4], inv)) |
+			(p[5] ^ ddr_pattern((uintptr_t) &p[5], inv)) |
+			(p[6] ^ ddr_pattern((uintptr_t) &p[6], inv)) |
+			(p[7] ^ ddr_pattern((uintptr_t) &p[7], inv));
+		if (diff == 0)
+			continue;
+
+		/* Locate the failing doubleword */
+		for (i = 0; i < 8; i++) {
+			if (p[i] != ddr_pattern((uintptr_t) &p[i], inv)) {
+				ERROR("DDR PATTERN: RD(%08lx): %016llx != %016llx\n",
+				      (uintptr_t) &p[i], (unsigned long long) p[i],
+				      (unsigned long long) ddr_pattern((uintptr_t) &p[i], inv));
+				return (uintptr_t) &p[i];
+			}
+		}
+	}
+
+	return 0;
+}
+
+static uint32_t ddr_test_mbps(uint64_t bytes, uint64_t ticks)
+{
+	if (ticks == 0)
+		return 0;
+
+	return (uint32_t) ((bytes * read_cntfrq_el0()) / (ticks * SIZE_M(1)));
+}
+
+/*******************************************************************************
+ * This function writes and checks an address dependent pattern and its
+ * inverse over the range, using doubleword accesses in cache line sized
+ * bursts. The write and read bandwidth are returned in 'bw'.
+ * Returns 0 if success, and address value else.
+ ******************************************************************************/
+uintptr_t ddr_test_pattern(uintptr_t ddr_base_addr, size_t ddr_size, bool cache,
+			   struct ddr_test_bw *bw)
+{
+	uintptr_t end = ddr_base_addr + (ddr_size & ~(DDR_TEST_BLOCK - 1U));
+	uint64_t wr_ticks = 0, rd_ticks = 0, start;
+	uint64_t inv = 0;
+	uintptr_t err;
+	int pass;
+
+	INFO("DDR pattern test begin, start %08lx, size 0x%08zx, cache %d\n",
+	     ddr_base_addr, ddr_size, cache);
+
+	if (cache)
+		inv_dcache_range(ddr_base_addr, end - ddr_base_addr);
+
+	for (pass = 0; pass < 2; pass++, inv = ~inv) {
+		start = read_cntpct_el0();
+		ddr_pattern_write(ddr_base_addr, end, inv);
+		/* Push the data out to DDR, so the check reads it back from there */
+		if (cache)
+			flush_dcache_range(ddr_base_addr, end - ddr_base_addr);
+		dsbsy();
+		wr_ticks += read_cntpct_el0() - start;
+
+		start = read_cntpct_el0();
+		err = ddr_pattern_check(ddr_base_addr, end, inv);
+		rd_ticks += read_cntpct_el0() - start;
+		if (err != 0)
+			return err;
+
+		if (cache)
+			inv_dcache_range(ddr_base_addr, end - ddr_base_addr);
+	}
+
+	bw->write_mbps = ddr_test_mbps(2ULL * (end - ddr_base_addr), wr_ticks);
+	bw->read_mbps = ddr_test_mbps(2ULL * (end - ddr_base_addr), rd_ticks);
+
+	INFO("DDR pattern test end, write %u MiB/s, read %u MiB/s\n",
+	     bw->write_mbps, bw->read_mbps);
+
+	return 0;
+}
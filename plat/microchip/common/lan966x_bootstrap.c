@@ -242,3 +242,105 @@ bool bootstrap_RxDataCrc(bootstrap_req_t *req, uint8_t *data)
 	bootstrap_RxPayload(data, req);
 	return bootstrap_RxCrcCheck(req);
 }
+
+static int bootstrap_RxBytes(uint8_t *data, uint32_t length)
+{
+	int c;
+
+	while (length--) {
+		if ((c = MON_GET()) < 0)
+			return -1;
+		*data++ = c;
+	}
+
+	return 0;
+}
+
+/* Read a bulk block header, sliding byte by byte until it looks sane */
+static int bootstrap_RxBulkHdr(bstrap_bulk_hdr_t *hdr, uint32_t block_size)
+{
+	uint8_t *raw = (uint8_t *)hdr;
+
+	if (bootstrap_RxBytes(raw, sizeof(*hdr)))
+		return -1;
+
+	while (hdr->magic != BSTRAP_BULK_MAGIC || hdr->len > block_size) {
+		memmove(raw, raw + 1, sizeof(*hdr) - 1);
+		if (bootstrap_RxBytes(raw + sizeof(*hdr) - 1, 1))
+			return -1;
+	}
+
+	return 0;
+}
+
+/*
+ * Receive 'length' bytes into 'data' with the windowed bulk protocol
+ * described in lan966x_bootstrap.h. Returns 0 when all data has been
+ * received and acknowledged, -1 on abort.
+ */
+int bootstrap_RxBulk(uint8_t *data, uint32_t length,
+		     const bstrap_bulk_cfg_t *cfg)
+{
+	bstrap_bulk_hdr_t hdr;
+	uint32_t offset = 0, crc, rx_crc, blocks = 0;
+	uint8_t *payload;
+	bool resync = false;
+	size_t skip;
+
+	/* Bulk data and replies are binary */
+	bootstrap_req_flags |= BSTRAP_REQ_FLAG_BINARY;
+
+	while (offset < length) {
+		if (bootstrap_RxBulkHdr(&hdr, cfg->block_size))
+			return -1;
+
+		if (hdr.len == 0) {
+			/* Abort, check the CRC before giving up */
+			if (bootstrap_RxBytes((uint8_t *)&rx_crc, sizeof(rx_crc)))
+				return -1;
+			if (rx_crc == Crc32c(0, &hdr, sizeof(hdr))) {
+				bootstrap_Tx(BOOTSTRAP_NACK, offset, 0, NULL);
+				return -1;
+			}
+			continue;
+		}
+
+		if (hdr.offset != offset ||
+		    (hdr.len != cfg->block_size && hdr.len != length - offset) ||
+		    hdr.len > length - offset) {
+			/* In flight before our NACK, or garbled: drop it */
+			for (skip = hdr.len + sizeof(rx_crc); skip > 0; skip--)
+				if (MON_GET() < 0)
+					return -1;
+			if (!resync) {
+				bootstrap_Tx(BOOTSTRAP_NACK, offset, 0, NULL);
+				resync = true;
+				blocks = 0;
+			}
+			continue;
+		}
+
+		payload = data + offset;
+		if (bootstrap_RxBytes(payload, hdr.len) ||
+		    bootstrap_RxBytes((uint8_t *)&rx_crc, sizeof(rx_crc)))
+			return -1;
+
+		crc = Crc32c(0, &hdr, sizeof(hdr));
+		crc = Crc32c(crc, payload, hdr.len);
+		if (crc != rx_crc) {
+			bootstrap_Tx(BOOTSTRAP_NACK, offset, 0, NULL);
+			resync = true;
+			blocks = 0;
+			continue;
+		}
+
+		offset += hdr.len;
+		resync = false;
+		if (++blocks == cfg->window || offset == length) {
+			bootstrap_Tx(BOOTSTRAP_ACK, offset, 0, NULL);
+			blocks = 0;
+		}
+	}
+
+	return 0;
+}
@@ -4,8 +4,10 @@
  * SPDX-License-Identifier: BSD-3-Clause
  */
 
+#include <arch_helpers.h>
 #include <assert.h>
 #include <common/debug.h>
+#include <common/image_decompress.h>
 #include <drivers/auth/crypto_mod.h>
 #include <drivers/io/io_storage.h>
 #include <drivers/microchip/lan966x_trng.h>
@@ -18,8 +20,11 @@
 #include <lib/mmio.h>
 #include <lib/xlat_tables/xlat_tables_compat.h>
 #include <plat/common/platform.h>
+#include <plat/microchip/common/plat_memcpy.h>
 #include <platform_def.h>
+#include <stdio.h>
 #include <tf_gunzip.h>
+#include <tf_unlz4.h>
 
 #include <lan96xx_common.h>
 #include <plat_bl2u_bootstrap.h>
@@ -43,6 +48,25 @@ static struct ddr_config current_ddr_config;
 static const uintptr_t ddr_base_addr = LAN966X_DDR_BASE;
 static bool ddr_was_initialized, cur_cache;
 
+/* Device writes are programmed, verified and timed in chunks of this size */
+#define WRITE_CHUNK_SIZE	SIZE_M(1)
+
+/* Largest eMMC read issued at once, the size of one ADMA2 transfer */
+#define EMMC_READ_CHUNK_SIZE	SIZE_M(8)
+
+/* Default amount of data read by the eMMC benchmark, in MiB */
+#define EMMC_BENCH_DEFAULT_MB	16U
+
+typedef int (*dev_io_t)(uint32_t offset, uintptr_t buf, uint32_t length);
+
+/* Time spent and bytes handled per stage, reported to the host */
+struct stage_stats {
+	uint64_t ticks;
+	uint32_t bytes;
+};
+
+static struct stage_stats stats_rx, stats_write, stats_verify;
+
 #if defined(LAN969X_SRAM_SIZE)
 #define SRAM_BUFFER BL2_LIMIT
 #define SRAM_SIZE   (LAN969X_SRAM_SIZE - BL1_RW_SIZE - BL2U_SIZE)
@@ -63,10 +87,42 @@ extern const struct ddr_config lan966x_ddr_config;
 #define  default_ddr_config lan966x_ddr_config
 #endif
 
-/* Check for GZIP header */
-static bool is_gzip(uint8_t *data)
+/* Select a decompressor by the data header, NULL for plain data */
+static decompressor_t *data_decompressor(const uint8_t *data)
 {
-	return data[0] == 0x1f && data[1] == 0x8b;
+	uint32_t magic = data[0] | (data[1] << 8) | (data[2] << 16) |
+		((uint32_t)data[3] << 24);
+
+	if (data[0] == 0x1f && data[1] == 0x8b)
+		return gunzip;
+	if (magic == LZ4_FRAME_MAGIC || magic == LZ4_LEGACY_MAGIC)
+		return unlz4;
+	return NULL;
+}
+
+static void stage_account(struct stage_stats *stats, uint64_t start, uint32_t bytes)
+{
+	stats->ticks += read_cntpct_el0() - start;
+	stats->bytes += bytes;
+}
+
+static uint32_t stage_kbps(const struct stage_stats *stats)
+{
+	if (stats->ticks == 0)
+		return 0;
+
+	return (uint32_t) (((uint64_t) stats->bytes * read_cntfrq_el0()) /
+			   (stats->ticks * 1024U));
+}
+
+static void stage_report(const char *result)
+{
+	char resp[96];
+
+	snprintf(resp, sizeof(resp), "%s (rx %u, write %u, verify %u KiB/s)",
+		 result, stage_kbps(&stats_rx), stage_kbps(&stats_write),
+		 stage_kbps(&stats_verify));
+	bootstrap_TxAckStr(resp);
 }
 
 static void handle_otp_read(bootstrap_req_t *req)
@@ -187,6 +243,7 @@ static bool recv_data(uint8_t *ptr, uint32_t length)
 static void handle_load_data(const bootstrap_req_t *req)
 {
 	uint32_t length = req->arg0;
+	uint64_t start;
 	data_rcv_length = 0;
 
 	VERBOSE("BL2U handle load data\n");
@@ -202,12 +259,60 @@ static void handle_load_data(const bootstrap_req_t *req)
 	}
 
 	/* Store data at start address of DDR memory (offset 0x0) */
-	if (recv_data((uint8_t *)fip_base_addr, length))
+	stats_rx = (struct stage_stats) { 0 };
+	start = read_cntpct_el0();
+	if (recv_data((uint8_t *)fip_base_addr, length)) {
+		stage_account(&stats_rx, start, length);
 		data_rcv_length = length;
+	}
 
 	VERBOSE("Received %d bytes\n", length);
 }
 
+static void handle_load_bulk(bootstrap_req_t *req)
+{
+	uint32_t length = req->arg0;
+	bstrap_bulk_cfg_t cfg;
+	uint64_t start;
+
+	data_rcv_length = 0;
+
+	VERBOSE("BL2U handle bulk load data\n");
+
+	if (req->len != sizeof(cfg) || !bootstrap_RxDataCrc(req, (uint8_t *)&cfg)) {
+		bootstrap_TxNack("Bulk config error");
+		return;
+	}
+
+	if (length == 0 || length > default_ddr_config.info.size) {
+		bootstrap_TxNack("Length Error");
+		return;
+	}
+
+	if (!ddr_was_initialized) {
+		bootstrap_TxNack("DDR must be initialized before data is sent");
+		return;
+	}
+
+	/* Accept what we can handle, the host follows our reply */
+	cfg.block_size = MIN(cfg.block_size, BSTRAP_BULK_BLOCK_MAX);
+	cfg.block_size = MAX(cfg.block_size, 1U);
+	cfg.window = MIN(cfg.window, BSTRAP_BULK_WINDOW_MAX);
+	cfg.window = MAX(cfg.window, 1U);
+	bootstrap_TxAckData_arg(&cfg, sizeof(cfg), length);
+
+	/* Store data at start address of DDR memory (offset 0x0) */
+	stats_rx = (struct stage_stats) { 0 };
+	start = read_cntpct_el0();
+	if (bootstrap_RxBulk((uint8_t *)fip_base_addr, length, &cfg) == 0) {
+		stage_account(&stats_rx, start, length);
+		data_rcv_length = length;
+		VERBOSE("Received %d bytes\n", length);
+	} else {
+		ERROR("Bulk transfer aborted\n");
+	}
+}
+
 static void handle_send_sram(bootstrap_req_t *req)
 {
 	uint32_t length = req->arg0;
@@ -283,6 +388,7 @@ static void handle_write_readback(bootstrap_req_t *req)
 	uint32_t args[2], dev, offset;
 	uint32_t ret;
 	uint8_t *sram_write_buffer;
+	decompressor_t *decompress;
 
 	if (!bootstrap_RxDataCrc(req, (uint8_t *)args)) {
 		bootstrap_TxNack("Incremental data args error");
@@ -304,7 +410,8 @@ static void handle_write_readback(bootstrap_req_t *req)
 	}
 
 	/* Check if we have compressed data */
-	if (is_gzip(sram_buffer)) {
+	decompress = data_decompressor(sram_buffer);
+	if (decompress != NULL) {
 		uintptr_t in_buf, work_buf, out_buf, out_start;
 		size_t in_len, work_len, out_len;
 
@@ -315,9 +422,9 @@ static void handle_write_readback(bootstrap_req_t *req)
 		work_len = sram_available - length;
 		out_start = out_buf = (uintptr_t) (sram_buffer + sram_available);
 		out_len = sram_available;
-		VERBOSE("gunzip(%p, %zd, %p, %zd, %p, %zd)\n",
+		VERBOSE("decompress(%p, %zd, %p, %zd, %p, %zd)\n",
 			(void*) in_buf, in_len, (void*) work_buf, work_len, (void*) out_buf, out_len);
-		if (gunzip(&in_buf, in_len, &out_buf, out_len, work_buf, work_len) == 0) {
+		if (decompress(&in_buf, in_len, &out_buf, out_len, work_buf, work_len) == 0) {
 			sram_write_buffer = (void*) out_start;
 			length = out_buf - out_start;
 			VERBOSE("Unzipped data, length now %d bytes\n", length);
@@ -379,14 +486,16 @@ static void handle_unzip_data(const bootstrap_req_t *req)
 {
 	uint8_t *ptr = (uint8_t *)fip_base_addr;
 	const char *resp = "Plain data";
+	decompressor_t *decompress;
 
 	/* See if this is compressed data */
-	if (is_gzip(ptr)) {
+	decompress = data_decompressor(ptr);
+	if (decompress != NULL) {
 		uintptr_t in_buf, work_buf, out_buf, out_start;
 		size_t in_len, work_len, out_len;
 
-		/* GZIP 'magic' seen, try to decompress */
-		INFO("Looks like GZIP data\n");
+		/* GZIP or LZ4 'magic' seen, try to decompress */
+		INFO("Looks like %s data\n", decompress == gunzip ? "GZIP" : "LZ4");
 
 		/* Set up decompress params */
 		in_buf = fip_base_addr;
@@ -395,9 +504,9 @@ static void handle_unzip_data(const bootstrap_req_t *req)
 		work_len = SIZE_M(16);
 		out_start = out_buf = work_buf + work_len;
 		out_len = default_ddr_config.info.size - (out_buf - in_buf);
-		VERBOSE("gunzip(%p, %zd, %p, %zd, %p, %zd)\n",
+		VERBOSE("decompress(%p, %zd, %p, %zd, %p, %zd)\n",
 			(void*) in_buf, in_len, (void*) work_buf, work_len, (void*) out_buf, out_len);
-		if (gunzip(&in_buf, in_len, &out_buf, out_len, work_buf, work_len) == 0) {
+		if (decompress(&in_buf, in_len, &out_buf, out_len, work_buf, work_len) == 0) {
 			out_len = out_buf - out_start;
 			memmove((void *)fip_base_addr, (const void *) out_start, out_len);
 			data_rcv_length = out_len;
@@ -445,7 +554,7 @@ static uint32_t chunked_mmc_read_blocks(uint32_t lba, uintptr_t buf_ptr, uint32_
 	uint32_t nread;
 
 	for (nread = 0; nread < length; ) {
-		size_t chunk = MIN((size_t) SIZE_M(1),
+		size_t chunk = MIN((size_t) EMMC_READ_CHUNK_SIZE,
 				   (size_t) (length - nread));
 		if (mmc_read_blocks(lba, buf_ptr, chunk) != chunk) {
 			ERROR("Incomplete read at LBA 0x%x, wrote %d of %d bytes\n", lba, nread, length);
@@ -486,98 +595,143 @@ int lan966x_bl2u_emmc_read(uint32_t offset, uintptr_t buf_ptr, uint32_t length)
 	return 0;
 }
 
-int lan966x_bl2u_emmc_verify(uint32_t lba, uintptr_t buf_ptr, size_t length)
+/*
+ * Readback buffer for verifying written chunks: the top of DDR, unless
+ * the data being written reaches up there.
+ */
+static uintptr_t verify_buffer(uintptr_t buf, uint32_t length)
 {
-	lan966x_key32_t data_write, data_read;
-	uint8_t *data = (void*) buf_ptr;
+	uintptr_t vbuf = ddr_base_addr + current_ddr_config.info.size - WRITE_CHUNK_SIZE;
 
-	/* Calculate SHA of written data */
-	sha_calc(SHA_MR_ALGO_SHA256, data, length, data_write.b, sizeof(data_write.b));
+	if (vbuf < (buf + length) && buf < (vbuf + WRITE_CHUNK_SIZE))
+		return 0;
 
-	size_t round_len = DIV_ROUND_UP_2EVAL(length, MMC_BLOCK_SIZE) * MMC_BLOCK_SIZE;
-	size_t size_read = chunked_mmc_read_blocks(lba, buf_ptr, round_len);
+	return vbuf;
+}
 
-	if (size_read != round_len) {
-		NOTICE("emmc_verify: Read %zd bytes, expected %zd\n", size_read, round_len);
-		return -EPIPE;
+static int verify_chunk(dev_io_t dev_read, uint32_t offset, uintptr_t buf,
+			uint32_t length, uintptr_t vbuf)
+{
+	lan966x_key32_t data_write, data_read;
+	uint64_t start = read_cntpct_el0();
+	int ret = 0;
+
+	if (vbuf != 0) {
+		if (dev_read(offset, vbuf, length))
+			ret = -EPIPE;
+		else if (memcmp((void *) buf, (void *) vbuf, length) != 0)
+			ret = -ENXIO;
+	} else {
+		/* No room for readback, compare hashes reading back in place */
+		sha_calc(SHA_MR_ALGO_SHA256, (void *) buf, length,
+			 data_write.b, sizeof(data_write.b));
+		if (dev_read(offset, buf, length)) {
+			ret = -EPIPE;
+		} else {
+			sha_calc(SHA_MR_ALGO_SHA256, (void *) buf, length,
+				 data_read.b, sizeof(data_read.b));
+			if (memcmp(data_write.b, data_read.b, sizeof(data_write.b)) != 0)
+				ret = -ENXIO;
+		}
 	}
 
-	/* Calculate SHA when read back write */
-	sha_calc(SHA_MR_ALGO_SHA256, data, length, data_read.b, sizeof(data_read.b));
+	if (ret)
+		NOTICE("Verify failed at 0x%x: %d\n", offset, ret);
 
-	if (memcmp(data_write.b, data_read.b, sizeof(data_write.b)) != 0) {
-		NOTICE("SHA mismatch, emmc verify failed");
-		return -ENXIO;
+	stage_account(&stats_verify, start, length);
+
+	return ret;
+}
+
+/*
+ * Write data to a device in chunks. When verifying, each chunk is read
+ * back and compared right after it is programmed, so a failure stops the
+ * write early and the data is not hashed as a whole.
+ */
+static int chunked_write_verify(dev_io_t dev_write, dev_io_t dev_read,
+				uint32_t offset, uintptr_t buf, uint32_t length,
+				bool verify)
+{
+	uintptr_t vbuf = verify ? verify_buffer(buf, length) : 0;
+	uint32_t done, chunk;
+	uint64_t start;
+	int ret;
+
+	for (done = 0; done < length; done += chunk) {
+		chunk = MIN((uint32_t) WRITE_CHUNK_SIZE, length - done);
+
+		start = read_cntpct_el0();
+		ret = dev_write(offset + done, buf + done, chunk);
+		stage_account(&stats_write, start, chunk);
+		if (ret)
+			return ret;
+
+		if (verify) {
+			ret = verify_chunk(dev_read, offset + done, buf + done,
+					   chunk, vbuf);
+			if (ret)
+				return ret;
+		}
 	}
 
-	INFO("emmc: Verified %zd bytes of data\n", length);
+	INFO("Wrote %d bytes%s\n", length, verify ? ", verified" : "");
 
 	return 0;
 }
 
-int lan966x_bl2u_emmc_write(uint32_t offset, uintptr_t buf_ptr, uint32_t length, bool verify)
+static int emmc_write_chunk(uint32_t offset, uintptr_t buf_ptr, uint32_t length)
 {
-	uint32_t round_len, lba, written;
-	int ret = 0;
-
-	/* Check multiple number of MMC_BLOCK_SIZE */
-	assert((offset % MMC_BLOCK_SIZE) == 0);
-
-	/* Convert offset to LBA */
-	lba = offset / MMC_BLOCK_SIZE;
+	uint32_t round_len = DIV_ROUND_UP_2EVAL(length, MMC_BLOCK_SIZE) * MMC_BLOCK_SIZE;
 
-	/* Calculate whole pages for mmc_write_blocks() */
-	round_len = DIV_ROUND_UP_2EVAL(length, MMC_BLOCK_SIZE) * MMC_BLOCK_SIZE;
+	if (chunked_mmc_write_blocks(offset / MMC_BLOCK_SIZE, buf_ptr, round_len) != round_len)
+		return -EIO;
 
-	VERBOSE("Write image to offset: 0x%x, length: 0x%x, LBA 0x%x, round_len 0x%x\n",
-		offset, length, lba, round_len);
+	return 0;
+}
 
-	written = chunked_mmc_write_blocks(lba, buf_ptr, round_len);
+int lan966x_bl2u_emmc_write(uint32_t offset, uintptr_t buf_ptr, uint32_t length, bool verify)
+{
+	/* Check multiple number of MMC_BLOCK_SIZE */
+	assert((offset % MMC_BLOCK_SIZE) == 0);
 
-	VERBOSE("Written 0x%0x of the requested 0x%0x bytes\n", written, round_len);
+	VERBOSE("Write image to offset: 0x%x, length: 0x%x\n", offset, length);
 
-	if (written != round_len) {
-		ret = -EIO;
-	} else {
-		if (verify)
-			ret = lan966x_bl2u_emmc_verify(lba, buf_ptr, length);
-	}
+	return chunked_write_verify(emmc_write_chunk, lan966x_bl2u_emmc_read,
+				    offset, buf_ptr, length, verify);
+}
 
-	return ret;
+static int qspi_write_chunk(uint32_t offset, uintptr_t buf_ptr, uint32_t length)
+{
+	return qspi_write(offset, (void *) buf_ptr, length);
 }
 
-int lan966x_bl2u_qspi_verify(uint32_t offset, uintptr_t buf_ptr, size_t length)
+static int qspi_read_chunk(uint32_t offset, uintptr_t buf_ptr, uint32_t length)
 {
-	lan966x_key32_t data_write, data_read;
-	uint8_t *data = (void*) buf_ptr;
 	size_t act_read;
 	int ret;
 
-	/* Calculate SHA of written data */
-	sha_calc(SHA_MR_ALGO_SHA256, data, length, data_write.b, sizeof(data_write.b));
-
 	ret = qspi_read(offset, buf_ptr, length, &act_read);
-	if (ret) {
-		NOTICE("qspi_verify: Read returns %d\n", ret);
-		return ret;
-	}
+	if (ret == 0 && act_read != length)
+		ret = -EPIPE;
 
-	if (act_read != length) {
-		NOTICE("qspi_verify: Read %zd bytes, expected %zd\n", act_read, length);
-		return -EPIPE;
-	}
+	return ret;
+}
 
-	/* Calculate SHA when read back write */
-	sha_calc(SHA_MR_ALGO_SHA256, data, length, data_read.b, sizeof(data_read.b));
+int lan966x_bl2u_qspi_write(uint32_t offset, uintptr_t buf_ptr, uint32_t length)
+{
+	struct qspi_write_stats stats;
+	int ret;
 
-	if (memcmp(data_write.b, data_read.b, sizeof(data_write.b)) != 0) {
-		NOTICE("SHA mismatch, qspi verify failed");
-		return -ENXIO;
-	}
+	qspi_clear_write_stats();
 
-	INFO("qspi: Verified %zd bytes of data\n", length);
+	ret = chunked_write_verify(qspi_write_chunk, qspi_read_chunk,
+				   offset, buf_ptr, length, true);
 
-	return 0;
+	qspi_get_write_stats(&stats);
+	NOTICE("QSPI: %u of %u sectors unchanged and skipped\n",
+	       stats.skipped, stats.sectors);
+
+	return ret;
 }
 
 static int fip_read_mmc(const char *name, uintptr_t buf_ptr, uint32_t len)
@@ -641,6 +795,8 @@ static void handle_write_image(const bootstrap_req_t * req)
 	/* Init IO layer */
 	lan966x_bl2u_io_init_dev(dev);
 
+	stats_write = stats_verify = (struct stage_stats) { 0 };
+
 	/* Write Flash */
 	switch (dev) {
 	case BOOT_SOURCE_EMMC:
@@ -648,9 +804,7 @@ static void handle_write_image(const bootstrap_req_t * req)
 		ret = lan966x_bl2u_emmc_write(0, fip_base_addr, data_rcv_length, verify);
 		break;
 	case BOOT_SOURCE_QSPI:
-		ret = qspi_write(0, (void*) fip_base_addr, data_rcv_length);
-		if (ret == 0)
-			ret = lan966x_bl2u_qspi_verify(0, fip_base_addr, data_rcv_length);
+		ret = lan966x_bl2u_qspi_write(0, fip_base_addr, data_rcv_length);
 		break;
 	default:
 		ret = -ENOTSUP;
@@ -669,7 +823,7 @@ static void handle_write_image(const bootstrap_req_t * req)
 			break;
 		}
 	else {
-		bootstrap_TxAckStr(verify ? "Image written and verified" : "Image written");
+		stage_report(verify ? "Image written and verified" : "Image written");
 	}
 }
 
@@ -745,9 +899,7 @@ int lan966x_bl2u_fip_update(boot_source_type boot_source,
 
 	case BOOT_SOURCE_QSPI:
 		INFO("Write FIP %d bytes to QSPI NOR\n", len);
-		ret = qspi_write(0, (void*) buf, len);
-		if (ret == 0)
-			ret = lan966x_bl2u_qspi_verify(0, buf, len);
+		ret = lan966x_bl2u_qspi_write(0, buf, len);
 		break;
 
 	default:
@@ -788,6 +940,8 @@ static void handle_write_fip(const bootstrap_req_t * req)
 	if (dev != lan966x_get_boot_source())
 		lan966x_bl2u_io_init_dev(dev);
 
+	stats_write = stats_verify = (struct stage_stats) { 0 };
+
 	/* Do the update - platform dependent */
 	ret = lan966x_bl2u_fip_update(dev, fip_base_addr, data_rcv_length, verify);
 
@@ -810,7 +964,7 @@ static void handle_write_fip(const bootstrap_req_t * req)
 			break;
 		}
 	} else {
-		bootstrap_TxAckStr(verify ? "FIP written and verified" : "FIP written");
+		stage_report(verify ? "FIP written and verified" : "FIP written");
 	}
 }
 
@@ -995,10 +1149,17 @@ static void handle_ddr_cfg_get(bootstrap_req_t *req)
 	bootstrap_TxAckData(&current_ddr_config, sizeof(current_ddr_config));
 }
 
+/*
+ * arg0 bit 0 enables the data cache, bit 1 skips the slow random sweep so
+ * the command can be used as a DDR bandwidth benchmark.
+ */
 static void handle_ddr_test(bootstrap_req_t *req)
 {
 	bool cache = !!(req->arg0 & 1);
+	bool sweep = !(req->arg0 & 2);
+	struct ddr_test_bw bw;
 	uintptr_t err_off;
+	char resp[64];
 
 	if (!ddr_was_initialized) {
 		bootstrap_TxNack("DDR not initialized");
@@ -1022,14 +1183,24 @@ static void handle_ddr_test(bootstrap_req_t *req)
 		return;
 	}
 
-	err_off = ddr_test_rnd(ddr_base_addr, current_ddr_config.info.size, cache, 0xdeadbeef);
+	err_off = ddr_test_pattern(ddr_base_addr, current_ddr_config.info.size, cache, &bw);
 	if (err_off != 0) {
-		bootstrap_TxNack_rc("DDR sweep test", err_off);
+		bootstrap_TxNack_rc("DDR pattern test", err_off);
 		return;
 	}
 
+	if (sweep) {
+		err_off = ddr_test_rnd(ddr_base_addr, current_ddr_config.info.size, cache, 0xdeadbeef);
+		if (err_off != 0) {
+			bootstrap_TxNack_rc("DDR sweep test", err_off);
+			return;
+		}
+	}
+
 	/* All good */
-	bootstrap_TxAckStr("Test succeeded");
+	snprintf(resp, sizeof(resp), "Test succeeded, write %u MiB/s, read %u MiB/s",
+		 bw.write_mbps, bw.read_mbps);
+	bootstrap_TxAckStr(resp);
 }
 
 static void handle_data_hash(bootstrap_req_t *req)
@@ -1080,6 +1251,73 @@ static void handle_read_reg(bootstrap_req_t *req)
 	bootstrap_TxAckData_arg(regbuf, req->len, req->arg0);
 }
 
+/*
+ * Measure eMMC/SD read throughput. arg0 holds the device in bits 0-6 and
+ * the number of MiB to read from the start of the device in bits 8-15.
+ * The data is read into DDR, above any uploaded data.
+ */
+static void handle_emmc_bench(const bootstrap_req_t *req)
+{
+	int dev = req->arg0 & 0x7F;
+	uint32_t mb = (req->arg0 >> 8) & 0xFF;
+	struct stage_stats bench = { 0 };
+	uintptr_t buf;
+	uint64_t start;
+	char resp[64];
+
+	if (!ddr_was_initialized) {
+		bootstrap_TxNack("DDR not initialized");
+		return;
+	}
+
+	if (dev != BOOT_SOURCE_EMMC && dev != BOOT_SOURCE_SDMMC) {
+		bootstrap_TxNack("Unsupported benchmark device");
+		return;
+	}
+
+	if (mb == 0)
+		mb = EMMC_BENCH_DEFAULT_MB;
+
+	buf = fip_base_addr + round_up(data_rcv_length, SIZE_M(1));
+	if ((buf + SIZE_M(mb)) > (ddr_base_addr + current_ddr_config.info.size)) {
+		bootstrap_TxNack("Benchmark data does not fit in DDR");
+		return;
+	}
+
+	/* Init IO layer */
+	lan966x_bl2u_io_init_dev(dev);
+
+	start = read_cntpct_el0();
+	if (lan966x_bl2u_emmc_read(0, buf, SIZE_M(mb)) != 0) {
+		bootstrap_TxNack("Benchmark read failed");
+		return;
+	}
+	stage_account(&bench, start, SIZE_M(mb));
+
+	snprintf(resp, sizeof(resp), "Read %u MiB (%u KiB/s)", mb, stage_kbps(&bench));
+	bootstrap_TxAckStr(resp);
+}
+
+/* Compare the copy routines, using the DDR above any uploaded data */
+static void handle_memcpy_bench(const bootstrap_req_t *req)
+{
+	uintptr_t buf, end;
+
+	if (!ddr_was_initialized) {
+		bootstrap_TxNack("DDR not initialized");
+		return;
+	}
+
+	buf = fip_base_addr + round_up(data_rcv_length, SIZE_M(1));
+	end = ddr_base_addr + current_ddr_config.info.size;
+	if (buf >= end || plat_memcpy_bench(buf, end - buf) != 0) {
+		bootstrap_TxNack("Copy benchmark failed");
+		return;
+	}
+
+	bootstrap_TxAck();
+}
+
 static void handle_sram_info(bootstrap_req_t *req)
 {
 	/* Return SRAM length */
@@ -1109,6 +1347,8 @@ void lan966x_bl2u_bootstrap_monitor(void)
 			handle_read_rom_version(&req);
 		else if (is_cmd(&req, BOOTSTRAP_SEND))		// S - Load data file
 			handle_load_data(&req);
+		else if (is_cmd(&req, BOOTSTRAP_SEND_BULK))	// K - Load data file, bulk transfer
+			handle_load_bulk(&req);
 		else if (is_cmd(&req, BOOTSTRAP_UNZIP))		// Z - Unzip data
 			handle_unzip_data(&req);
 		else if (is_cmd(&req, BOOTSTRAP_IMAGE))		// I - Copy uploaded raw image from DDR memory to flash device
@@ -1137,6 +1377,10 @@ void lan966x_bl2u_bootstrap_monitor(void)
 			handle_data_hash(&req);
 		else if (is_cmd(&req, BOOTSTRAP_READ_REG))	// x - Read registers
 			handle_read_reg(&req);
+		else if (is_cmd(&req, BOOTSTRAP_EMMC_BENCH))	// E - eMMC read benchmark
+			handle_emmc_bench(&req);
+		else if (is_cmd(&req, BOOTSTRAP_MEMCPY_BENCH))	// M - Copy benchmark
+			handle_memcpy_bench(&req);
 		else if (is_cmd(&req, BOOTSTRAP_SRAM_INFO))	// s - Get SRAM info
 			handle_sram_info(&req);
 		else if (is_cmd(&req, BOOTSTRAP_SEND_SRAM))	// J - Upload SRAM
@@ -4,11 +4,18 @@
  * SPDX-License-Identifier: BSD-3-Clause
  */
 
-#include <drivers/microchip/sha.h>
-#include <plat_crypto.h>
+#include <errno.h>
 #include <stddef.h>
 #include <string.h>
 
+#include <drivers/auth/crypto_mod.h>
+#include <drivers/microchip/aes.h>
+#include <drivers/microchip/sha.h>
+#include <lan96xx_common.h>
+#include <plat/common/platform.h>
+#include <plat_crypto.h>
+#include <tools_share/firmware_encrypted.h>
+
 /*
  * Derive a 32 byte key with a 32 byte salt, output a 32 byte key
  */
@@ -30,3 +37,44 @@ int lan966x_derive_key(const lan966x_key32_t *in,
 
 	return ret;
 }
+
+#if defined(IMAGE_BL2)
+/* plat_load_hash_start() is per SoC, it knows which reads are hashed already */
+void plat_load_hash_update(uintptr_t data, size_t len)
+{
+	sha_load_update((void *) data, len);
+}
+
+void plat_load_hash_finish(int result)
+{
+	sha_load_finish(result == 0);
+}
+
+int plat_decrypt_stream_start(const struct fw_enc_hdr *hdr, const uint8_t *key,
+			      size_t key_len, unsigned int key_flags,
+			      size_t data_len)
+{
+#if defined(XDMAC_PIPELINE_SUPPPORT)
+	/* The QSPI read pipeline already decrypts while reading */
+	if (lan966x_get_boot_source() == BOOT_SOURCE_QSPI)
+		return -ENOTSUP;
+#endif
+
+	if ((hdr->dec_algo != CRYPTO_GCM_DECRYPT) ||
+	    ((key_flags & ENC_KEY_IS_IDENTIFIER) != 0))
+		return -ENOTSUP;
+
+	return aes_gcm_decrypt_start(data_len, key, key_len,
+				     hdr->iv, hdr->iv_len);
+}
+
+void plat_decrypt_stream_update(uintptr_t data, size_t len)
+{
+	aes_gcm_decrypt_update((void *) data, len);
+}
+
+int plat_decrypt_stream_finish(const struct fw_enc_hdr *hdr)
+{
+	return aes_gcm_decrypt_finish(hdr->tag, hdr->tag_len);
+}
+#endif
@@ -0,0 +1,193 @@
+/*
+ * Copyright (C) 2026 Microchip Technology Inc. and its subsidiaries.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <arch_helpers.h>
+#include <common/debug.h>
+#include <drivers/microchip/xdmac.h>
+#include <errno.h>
+#include <lib/utils_def.h>
+#include <plat/microchip/common/plat_memcpy.h>
+#include <platform_def.h>
+#include <string.h>
+
+#if !defined(PLAT_MEMCPY_DMA_THRESHOLD)
+#define PLAT_MEMCPY_DMA_THRESHOLD	SIZE_K(1)
+#endif
+
+/* Largest XDMAC copy, well below the microblock length limit */
+#define PLAT_MEMCPY_DMA_CHUNK	SIZE_M(8)
+
+/* Copies shorter than this are not worth aligning */
+#define PLAT_MEMCPY_MIN_ALIGN	16U
+
+typedef uint64_t __attribute__((__may_alias__)) dword_t;
+typedef unsigned long __attribute__((__may_alias__)) word_t;
+
+#define DWORD_SIZE	sizeof(dword_t)
+#define WORD_SIZE	sizeof(word_t)
+
+void *plat_memcpy_cpu(void *dst, const void *src, size_t len)
+{
+	uint8_t *d = dst;
+	const uint8_t *s = src;
+
+	if (len >= PLAT_MEMCPY_MIN_ALIGN) {
+		while (((uintptr_t) d & (DWORD_SIZE - 1U)) != 0U) {
+			*d++ = *s++;
+			len--;
+		}
+
+		if (((uintptr_t) s & (DWORD_SIZE - 1U)) == 0U) {
+			dword_t *dd = (dword_t *) d;
+			const dword_t *sd = (const dword_t *) s;
+
+			/* Loads first, so they pair up as LDP/STP or LDRD/STRD */
+			for (; len >= (4U * DWORD_SIZE); len -= 4U * DWORD_SIZE) {
+				dword_t a = sd[0], b = sd[1], c = sd[2], e = sd[3];
+
+				dd[0] = a;
+				dd[1] = b;
+				dd[2] = c;
+				dd[3] = e;
+				dd += 4;
+				sd += 4;
+			}
+			for (; len >= DWORD_SIZE; len -= DWORD_SIZE)
+				*dd++ = *sd++;
+
+			d = (uint8_t *) dd;
+			s = (const uint8_t *) sd;
+		} else if (((uintptr_t) s & (WORD_SIZE - 1U)) == 0U) {
+			/* Only on AArch32, where a word is half a doubleword */
+			word_t *dw = (word_t *) d;
+			const word_t *sw = (const word_t *) s;
+
+			for (; len >= WORD_SIZE; len -= WORD_SIZE)
+				*dw++ = *sw++;
+
+			d = (uint8_t *) dw;
+			s = (const uint8_t *) sw;
+		} else {
+			/*
+			 * Build each 'dst' word from the top of one aligned
+			 * 'src' word and the bottom of the next one. The loads
+			 * never leave the words holding the bytes to copy.
+			 */
+			unsigned int shift = ((uintptr_t) s & (WORD_SIZE - 1U)) * 8U;
+			const word_t *sw = (const word_t *) ((uintptr_t) s & ~(WORD_SIZE - 1U));
+			word_t *dw = (word_t *) d;
+			size_t n = len / WORD_SIZE;
+			word_t lo, hi;
+
+			s += n * WORD_SIZE;
+			len -= n * WORD_SIZE;
+
+			for (lo = *sw++; n > 0U; n--) {
+				hi = *sw++;
+				*dw++ = (lo >> shift) | (hi << ((WORD_SIZE * 8U) - shift));
+				lo = hi;
+			}
+
+			d = (uint8_t *) dw;
+		}
+	}
+
+	while (len-- > 0U)
+		*d++ = *s++;
+
+	return dst;
+}
+
+void *plat_memcpy(void *dst, const void *src, size_t len)
+{
+	uint8_t *d = dst;
+	const uint8_t *s = src;
+	size_t chunk;
+
+	if (len < PLAT_MEMCPY_DMA_THRESHOLD)
+		return plat_memcpy_cpu(dst, src, len);
+
+	for (; len > 0U; len -= chunk, d += chunk, s += chunk) {
+		chunk = MIN(len, (size_t) PLAT_MEMCPY_DMA_CHUNK);
+		xdmac_memcpy(d, s, chunk, XDMA_DIR_MEM_TO_MEM, XDMA_NONE);
+	}
+
+	return dst;
+}
+
+#if defined(IMAGE_BL2U)
+/* Each measurement copies at least this much */
+#define BENCH_MIN_BYTES		SIZE_M(4)
+#define BENCH_MAX_SIZE		SIZE_M(1)
+
+static void *bench_xdmac(void *dst, const void *src, size_t len)
+{
+	xdmac_memcpy(dst, src, len, XDMA_DIR_MEM_TO_MEM, XDMA_NONE);
+	return dst;
+}
+
+static const struct {
+	const char *name;
+	void *(*copy)(void *dst, const void *src, size_t len);
+} bench_variants[] = {
+	{ "memcpy", memcpy },
+	{ "cpu", plat_memcpy_cpu },
+	{ "xdmac", bench_xdmac },
+	{ "auto", plat_memcpy },
+};
+
+static const size_t bench_sizes[] = {
+	256U, SIZE_K(4), SIZE_K(64), BENCH_MAX_SIZE,
+};
+
+int plat_memcpy_bench(uintptr_t buf, size_t buf_size)
+{
+	/* Leave room for the misaligned runs */
+	uint8_t *src = (uint8_t *) buf;
+	uint8_t *dst = src + BENCH_MAX_SIZE + DWORD_SIZE;
+	unsigned int v, i, misalign, rep, reps;
+	uint64_t start, ticks;
+	size_t size;
+
+	if (buf_size < (2U * (BENCH_MAX_SIZE + DWORD_SIZE)))
+		return -ENOMEM;
+
+	for (i = 0; i < (BENCH_MAX_SIZE + DWORD_SIZE); i++)
+		src[i] = (uint8_t) ((i * 7U) ^ (i >> 8));
+
+	for (misalign = 0; misalign < 2U; misalign++) {
+		for (i = 0; i < ARRAY_SIZE(bench_sizes); i++) {
+			size = bench_sizes[i];
+			reps = MAX(1U, (unsigned int) (BENCH_MIN_BYTES / size));
+
+			for (v = 0; v < ARRAY_SIZE(bench_variants); v++) {
+				memset(dst, 0, size);
+				flush_dcache_range((uintptr_t) dst, size);
+
+				start = read_cntpct_el0();
+				for (rep = 0; rep < reps; rep++)
+					bench_variants[v].copy(dst, src + misalign, size);
+				ticks = read_cntpct_el0() - start;
+
+				if (memcmp(dst, src + misalign, size) != 0) {
+					ERROR("memcpy bench: %s failed, size %zu, misalign %u\n",
+					      bench_variants[v].name, size, misalign);
+					return -EIO;
+				}
+
+				NOTICE("memcpy bench: %-6s %7zu bytes %s: %u MiB/s\n",
+				       bench_variants[v].name, size,
+				       misalign ? "misaligned" : "aligned",
+				       ticks == 0 ? 0 :
+				       (unsigned int) (((uint64_t) size * reps * read_cntfrq_el0()) /
+						       (ticks * SIZE_M(1))));
+			}
+		}
+	}
+
+	return 0;
+}
+#endif /* defined(IMAGE_BL2U) */
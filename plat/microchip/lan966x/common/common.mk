@@ -37,9 +37,18 @@ FIP_ALIGN		:= 512
 # Must be zero on aarch32
 ENABLE_SVE_FOR_NS		:=	0
 
+# Keep the FIP backend open across FIP file operations
+$(eval $(call add_define,FIP_PERSISTENT_BACKEND))
+
 # Save some memory for GUIDs not used
 $(eval $(call add_define,GPT_NO_GUID))
 
+# Read GPT entries on demand, lookups happen before the FIP is opened
+$(eval $(call add_define,PARTITION_LAZY_LOAD))
+
+# Skip erasing and programming QSPI sectors already holding the data
+$(eval $(call add_define,QSPI_DELTA_WRITE))
+
 # Pass LAN966x_MAX_CPUS_PER_CLUSTER to the build system.
 $(eval $(call add_define,LAN966x_MAX_CPUS_PER_CLUSTER))
 
@@ -48,6 +57,7 @@ $(eval $(call add_define,LAN966x_MAX_PE_PER_CPU))
 
 include lib/xlat_tables_v2/xlat_tables.mk
 include lib/zlib/zlib.mk
+include lib/lz4/lz4.mk
 
 $(info Including platform TBBR)
 # Mbed TLS heap size is smal as we only use the asn1 parsing functions
@@ -110,6 +120,7 @@ PLAT_BL_COMMON_SOURCES	+=	\
 				plat/microchip/common/lan966x_crc32.c			\
 				plat/microchip/common/lan96xx_common.c			\
 				plat/microchip/common/plat_crypto.c			\
+				plat/microchip/common/plat_memcpy.c			\
 				plat/microchip/common/plat_tbbr.c			\
 				plat/microchip/lan966x/common/${ARCH}/plat_helpers.S	\
 				plat/microchip/lan966x/common/lan966x_common.c		\
@@ -137,7 +148,8 @@ BL2_SOURCES		+=	\
 				plat/microchip/lan966x/common/lan966x_tbbr.c		\
 				plat/microchip/lan966x/common/lan966x_tz.c
 
-BL2U_SOURCES		+=	plat/microchip/common/ddr_test.c			\
+BL2U_SOURCES		+=	$(LZ4_SOURCES)						\
+				plat/microchip/common/ddr_test.c			\
 				plat/microchip/common/lan966x_bootstrap.c		\
 				plat/microchip/common/lan966x_fw_bind.c			\
 				plat/microchip/common/plat_bl2u_bootstrap.c		\
@@ -38,6 +38,13 @@
 #define MAX_IO_HANDLES			4
 /* eMMC RPMB and eMMC User Data */
 #define MAX_IO_BLOCK_DEVICES		U(2)
+/* FIP ToC entries indexed in SRAM */
+#define FIP_TOC_INDEX_ENTRIES		U(24)
+
+#if defined(IMAGE_BL2)
+/* io_block LRU cache for partial block reads */
+#define IO_BLOCK_CACHE_ENTRIES		U(4)
+#endif
 
 /*
  * BL1 specific defines.
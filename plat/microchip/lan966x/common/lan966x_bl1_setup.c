@@ -9,6 +9,7 @@
 #include <bl1/bl1.h>
 #include <common/bl_common.h>
 #include <drivers/generic_delay_timer.h>
+#include <drivers/microchip/otp.h>
 #include <fw_config.h>
 #include <lib/utils.h>
 #include <lib/xlat_tables/xlat_tables_compat.h>
@@ -130,6 +131,8 @@ void bl1_platform_setup(void)
 
 void bl1_plat_prepare_exit(entry_point_info_t *ep_info)
 {
+	/* Don't leave OTP data behind in BL1 RW memory */
+	otp_cache_release();
 }
 
 /*******************************************************************************
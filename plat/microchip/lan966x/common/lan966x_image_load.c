@@ -39,6 +39,9 @@ void plat_flush_next_bl_params(void)
 		NOTICE("OTP: Available for non-secure provisioning\n");
 	}
 
+	/* The OTP shadow must not outlive the read protection */
+	otp_cache_release();
+
         /* Zero out PKCL to ensure not leaking data */
         VERBOSE("Zero PKCL RAM, just before BL2 is done\n");
         memset((void*) LAN966X_PKCL_RAM_BASE, 0, LAN966X_PKCL_RAM_SIZE);
@@ -13,17 +13,23 @@
 #include <arch_helpers.h>
 #include <common/debug.h>
 #include <drivers/auth/auth_mod.h>
+#include <drivers/auth/crypto_mod.h>
 #include <drivers/io/io_driver.h>
 #include <drivers/io/io_encrypted.h>
 #include <drivers/io/io_fip.h>
 #include <drivers/io/io_block.h>
 #include <drivers/io/io_memmap.h>
 #include <drivers/io/io_storage.h>
+#include <drivers/microchip/aes.h>
+#include <drivers/microchip/sha.h>
+#include <drivers/microchip/xdmac.h>
 #include <drivers/mmc.h>
 #include <drivers/partition/partition.h>
 #include <lib/mmio.h>
+#include <tools_share/firmware_encrypted.h>
 #include <tools_share/firmware_image_package.h>
 #include <plat/common/platform.h>
+#include <plat/microchip/common/plat_memcpy.h>
 #include <common/desc_image_load.h>
 
 #include "lan966x_private.h"
@@ -60,6 +66,42 @@ static const io_dev_connector_t *enc_dev_con;
 #define LAN966X_QSPI0_FIP2_OFFSET	(LAN966X_QSPI0_FIP_OFFSET + (1024 * NT_FIP_SIZE))
 
 #if defined(IMAGE_BL2)
+/* Image to hash while it is copied, set by plat_load_hash_start() */
+static struct {
+	uintptr_t base;
+	size_t size;
+} memmap_hash_image;
+
+static int memmap_dma_copy(uintptr_t dst, uintptr_t src, size_t len)
+{
+	if (dst == memmap_hash_image.base && len == memmap_hash_image.size) {
+		memmap_hash_image.size = 0;
+		if (sha_load_copy((void *) dst, (const void *) src, len,
+				  XDMA_QSPI0_RX) == 0)
+			return 0;
+	}
+
+	plat_memcpy((void *) dst, (const void *) src, len);
+	return 0;
+}
+
+static int memmap_dma_start(uintptr_t dst, uintptr_t src, size_t len)
+{
+	return xdmac_memcpy_start((void *) dst, (const void *) src, len,
+				  XDMA_DIR_MEM_TO_MEM, XDMA_QSPI0_RX);
+}
+
+/*
+ * QSPI reads are done by the XDMAC. When an image is read in one go, it
+ * is fed to the SHA engine at the same time, so it is hashed in the same
+ * pass that copies it.
+ */
+static const io_memmap_dev_spec_t memmap_dev_spec = {
+	.copy = memmap_dma_copy,
+	.copy_start = memmap_dma_start,
+	.copy_poll = xdmac_memcpy_poll,
+};
+
 static uint8_t mmc_buf[MMC_BUF_SIZE] __attribute__ ((aligned (MMC_BLOCK_SIZE)));
 #if defined(LAN966X_DUAL_BL33)
 static bool primary_image_failure;
@@ -79,6 +121,8 @@ static const io_block_dev_spec_t mmc_dev_spec = {
 	.ops = {
 		.read = mmc_read_blocks,
 		.write = NULL,
+		.read_start = mmc_read_blocks_start,
+		.read_poll = mmc_read_blocks_poll,
 		},
 	.block_size = MMC_BLOCK_SIZE,
 };
@@ -88,6 +132,7 @@ static const io_block_dev_spec_t mmc_dev_spec = {
  * conjunction with BL1 monitor mode.
  */
 enum {
+	FIP_SELECT_NONE = -1,
 	FIP_SELECT_RAM_FIP,
 	FIP_SELECT_DEFAULT,
 	/* Note - the 'sources' below are not available in BL1 as its
@@ -101,6 +146,8 @@ enum {
 #endif
 };
 static int fip_select;
+/* Source the FIP device was last initialized from */
+static int fip_dev_select = FIP_SELECT_NONE;
 
 /* Data will be fetched from the GPT */
 static io_block_spec_t fip_mmc_block_spec;
@@ -369,8 +416,20 @@ static io_block_spec_t ram_fip_spec;
 
 void plat_bootstrap_io_enable_ram_fip(size_t offset, size_t length)
 {
+	int result __unused;
+
 	ram_fip_spec.offset = offset;
 	ram_fip_spec.length = length;
+
+	/* A new RAM FIP may reuse the buffer, drop the cached FIP state */
+	if (fip_dev_select != FIP_SELECT_NONE) {
+		result = io_dev_close(fip_dev_handle);
+		assert(result == 0);
+		result = io_dev_open(fip_dev_con, (uintptr_t)NULL,
+				     &fip_dev_handle);
+		assert(result == 0);
+		fip_dev_select = FIP_SELECT_NONE;
+	}
 }
 
 static int check_ram_fip(const uintptr_t spec)
@@ -458,14 +517,24 @@ static int check_fip(const uintptr_t spec)
 	int result;
 	uintptr_t local_image_handle;
 
-	/* See if a Firmware Image Package is available */
-	result = io_dev_init(fip_dev_handle, (uintptr_t)FIP_IMAGE_ID);
-	if (result == 0) {
-		result = io_open(fip_dev_handle, spec, &local_image_handle);
-		if (result == 0) {
-			VERBOSE("Using FIP\n");
-			io_close(local_image_handle);
+	/*
+	 * See if a Firmware Image Package is available. The FIP device
+	 * (and its backend session) is only re-initialized when the FIP
+	 * source changes, not for every image.
+	 */
+	if (fip_dev_select != fip_select) {
+		fip_dev_select = FIP_SELECT_NONE;
+		result = io_dev_init(fip_dev_handle, (uintptr_t)FIP_IMAGE_ID);
+		if (result != 0) {
+			return result;
 		}
+		fip_dev_select = fip_select;
+	}
+
+	result = io_open(fip_dev_handle, spec, &local_image_handle);
+	if (result == 0) {
+		VERBOSE("Using FIP\n");
+		io_close(local_image_handle);
 	}
 	return result;
 }
@@ -582,8 +651,13 @@ void lan966x_io_setup(void)
 	result = register_io_dev_memmap(&memmap_dev_con);
 	assert(result == 0);
 
+#if defined(IMAGE_BL2)
+	result = io_dev_open(memmap_dev_con, (uintptr_t)&memmap_dev_spec,
+			     &memmap_dev_handle);
+#else
 	result = io_dev_open(memmap_dev_con, (uintptr_t)NULL,
 			     &memmap_dev_handle);
+#endif
 	assert(result == 0);
 
 	result = register_io_dev_enc(&enc_dev_con);
@@ -773,6 +847,7 @@ done:
 int bl2_plat_handle_post_image_load(unsigned int image_id)
 {
 	bl_mem_params_node_t *bl_mem_params = get_bl_mem_params_node(image_id);
+	unsigned int hits, misses;
 	uint32_t off, src;
 
 	assert(bl_mem_params);
@@ -811,6 +886,11 @@ int bl2_plat_handle_post_image_load(unsigned int image_id)
 		mmio_write_32(CPU_GPR(LAN966X_CPU_BASE, 1), 0xAFEA0000 | src);
 		mmio_write_32(CPU_GPR(LAN966X_CPU_BASE, 2), off);
 		INFO("GPR: Set 'Loaded From' = src %d, offset %08x\n", src, off);
+		VERBOSE("FIP: %u backend opens saved\n",
+			fip_dev_get_backend_opens_saved());
+		VERBOSE("FIP: %u header/ToC reads\n", fip_dev_get_toc_reads());
+		io_block_get_cache_stats(&hits, &misses);
+		VERBOSE("io_block: cache %u hits, %u misses\n", hits, misses);
 		break;
 	default:
 		/* Do nothing in default case */
@@ -819,3 +899,26 @@ int bl2_plat_handle_post_image_load(unsigned int image_id)
 
 	return 0;
 }
+
+#if defined(IMAGE_BL2)
+int plat_load_hash_start(unsigned int image_id, uintptr_t dev_handle,
+			 uintptr_t image_base, size_t image_size)
+{
+	/* Any previous streamed hash is stale now */
+	sha_load_invalidate();
+	memmap_hash_image.size = 0;
+
+	/* Encrypted images are read in one go by io_encrypted */
+	if (dev_handle == enc_dev_handle)
+		return -ENOTSUP;
+
+	/* A single QSPI read copies and hashes the image, see memmap_dma_copy() */
+	if (lan966x_get_boot_source() == BOOT_SOURCE_QSPI) {
+		memmap_hash_image.base = image_base;
+		memmap_hash_image.size = image_size;
+		return -ENOTSUP;
+	}
+
+	return sha_load_start((void *) image_base, image_size);
+}
+#endif
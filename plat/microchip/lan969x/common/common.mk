@@ -7,6 +7,7 @@
 include lib/xlat_tables_v2/xlat_tables.mk
 include drivers/arm/gic/v2/gicv2.mk
 include lib/zlib/zlib.mk
+include lib/lz4/lz4.mk
 include lib/libfit/libfit.mk
 include lib/libfdt/libfdt.mk
 include common/fdt_wrappers.mk
@@ -17,6 +18,15 @@ include drivers/microchip/crypto/lan969x_crypto.mk
 # MCHP SOC family
 $(eval $(call add_define,MCHP_SOC_LAN969X))
 
+# Keep the FIP backend open across FIP file operations
+$(eval $(call add_define,FIP_PERSISTENT_BACKEND))
+
+# Read GPT entries on demand, lookups happen before the FIP is opened
+$(eval $(call add_define,PARTITION_LAZY_LOAD))
+
+# Skip erasing and programming QSPI sectors already holding the data
+$(eval $(call add_define,QSPI_DELTA_WRITE))
+
 # Use QSPI pipelined XDMA
 $(eval $(call add_define,XDMAC_PIPELINE_SUPPPORT))
 
@@ -65,11 +75,11 @@ PLAT_BL_COMMON_SOURCES	:=	${FDT_WRAPPERS_SOURCES}			\
 				drivers/microchip/otp/otp.c		\
 				drivers/microchip/trng/lan966x_trng.c	\
 				drivers/microchip/tz_matrix/tz_matrix.c	\
-				plat/microchip/common/duff_memcpy.c	\
 				plat/microchip/common/fw_config_dt.c	\
 				plat/microchip/common/lan966x_crc32.c	\
 				plat/microchip/common/lan96xx_common.c	\
 				plat/microchip/common/plat_crypto.c	\
+				plat/microchip/common/plat_memcpy.c	\
 				plat/microchip/common/plat_tbbr.c
 
 BL1_SOURCES		+=	lib/cpus/aarch64/cortex_a53.S			\
@@ -91,7 +101,8 @@ BL2_SOURCES		+=	common/desc_image_load.c			\
 				plat/microchip/common/lan966x_sjtag.c		\
 				plat/microchip/lan969x/common/lan969x_io_storage.c
 
-BL2U_SOURCES		+=	drivers/arm/tzc/tzc400.c			\
+BL2U_SOURCES		+=	$(LZ4_SOURCES)					\
+				drivers/arm/tzc/tzc400.c			\
 				${LAN969X_PLAT_COMMON}/lan969x_bl2u_setup.c	\
 				${LAN969X_PLAT_COMMON}/lan969x_tz.c		\
 				plat/microchip/common/lan966x_bootstrap.c	\
@@ -173,6 +184,16 @@ else
     TF_CFLAGS_aarch64	+=	-mtune=cortex-a53
 endif
 
+# Cortex-A53 implements the ARMv8.0 CRC32 instructions, used by Crc32c()
+ifeq (${ARM_ARCH_MAJOR},8)
+    ifeq (${ARM_ARCH_MINOR},0)
+        BL1_CPPFLAGS	+=	-march=armv8-a+crc
+        BL2_CPPFLAGS	+=	-march=armv8-a+crc
+        BL2U_CPPFLAGS	+=	-march=armv8-a+crc
+        BL31_CPPFLAGS	+=	-march=armv8-a+crc
+    endif
+endif
+
 # Build config flags
 # ------------------
 
@@ -130,6 +130,8 @@ void bl1_platform_setup(void)
 
 void bl1_plat_prepare_exit(entry_point_info_t *ep_info)
 {
+	/* Don't leave OTP data behind in BL1 RW memory */
+	otp_cache_release();
 }
 
 void plat_bootstrap_trigger_fwu(void)
@@ -163,6 +163,9 @@ void plat_flush_next_bl_params(void)
 {
 	flush_bl_params_desc();
 
+	/* Don't leave OTP data behind in BL2 memory */
+	otp_cache_release();
+
 	/* Last TZPM settings */
 	VERBOSE("Enable last NS devices\n");
 	lan969x_tz_finish();
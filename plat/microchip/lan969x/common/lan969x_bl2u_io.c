@@ -246,9 +246,7 @@ static int fip_update(const char *name, uintptr_t buf_ptr, uint32_t len, bool ve
 			break;
 		case BOOT_SOURCE_QSPI:
 			NOTICE("QSPI: Fip update '%s' @ %08lx, len %d\n", name, entry->start, len);
-			ret = qspi_write(entry->start, (void*) buf_ptr, len);
-			if (ret == 0)
-				ret = lan966x_bl2u_qspi_verify(entry->start, buf_ptr, len);
+			ret = lan966x_bl2u_qspi_write(entry->start, buf_ptr, len);
 			NOTICE("QSPI: Fip update '%s': ret %d\n", name, ret);
 			break;
 		default:
@@ -11,6 +11,7 @@
 #include <arch_helpers.h>
 #include <common/debug.h>
 #include <drivers/auth/auth_mod.h>
+#include <drivers/auth/crypto_mod.h>
 #include <drivers/io/io_block.h>
 #include <drivers/io/io_driver.h>
 #include <drivers/io/io_encrypted.h>
@@ -19,6 +20,8 @@
 #include <drivers/io/io_mtd.h>
 #include <drivers/io/io_storage.h>
 #include <drivers/microchip/qspi.h>
+#include <drivers/microchip/aes.h>
+#include <drivers/microchip/sha.h>
 #include <drivers/microchip/tz_matrix.h>
 #include <drivers/mmc.h>
 #include <drivers/partition/partition.h>
@@ -27,6 +30,7 @@
 #include <lib/mmio.h>
 #include <plat/common/platform.h>
 #include <platform_def.h>
+#include <tools_share/firmware_encrypted.h>
 #include <tools_share/firmware_image_package.h>
 
 #include "lan969x_private.h"
@@ -73,6 +77,8 @@ static const io_block_dev_spec_t mmc_dev_spec = {
 	.ops = {
 		.read = mmc_read_blocks,
 		.write = NULL,
+		.read_start = mmc_read_blocks_start,
+		.read_poll = mmc_read_blocks_poll,
 		},
 	.block_size = MMC_BLOCK_SIZE,
 };
@@ -88,6 +94,7 @@ static io_mtd_dev_spec_t spi_nor_dev_spec = {
  * State data about alternate boot source(s).
  */
 enum {
+	FIP_SELECT_NONE = -1,
 	FIP_SELECT_RAM_FIP,
 	FIP_SELECT_DEFAULT,	/* "fip" */
 	FIP_SELECT_FALLBACK,	/* "fip.bak" */
@@ -98,7 +105,8 @@ enum {
 #endif
 };
 static int fip_select;
-static bool fip_spec_valid;
+/* Source the FIP device was last initialized from */
+static int fip_dev_select = FIP_SELECT_NONE;
 
 /* Data will be fetched from the GPT */
 static io_block_spec_t fip_block_spec;
@@ -505,8 +513,20 @@ static io_block_spec_t ram_fip_spec;
 
 void plat_bootstrap_io_enable_ram_fip(size_t offset, size_t length)
 {
+	int result __unused;
+
 	ram_fip_spec.offset = offset;
 	ram_fip_spec.length = length;
+
+	/* A new RAM FIP may reuse the buffer, drop the cached FIP state */
+	if (fip_dev_select != FIP_SELECT_NONE) {
+		result = io_dev_close(fip_dev_handle);
+		assert(result == 0);
+		result = io_dev_open(fip_dev_con, (uintptr_t)NULL,
+				     &fip_dev_handle);
+		assert(result == 0);
+		fip_dev_select = FIP_SELECT_NONE;
+	}
 }
 
 static int check_ram_fip(const uintptr_t spec)
@@ -555,14 +575,24 @@ static int check_fip(const uintptr_t spec)
 	int result;
 	uintptr_t local_image_handle;
 
-	/* See if a Firmware Image Package is available */
-	result = io_dev_init(fip_dev_handle, (uintptr_t)FIP_IMAGE_ID);
-	if (result == 0) {
-		result = io_open(fip_dev_handle, spec, &local_image_handle);
-		if (result == 0) {
-			VERBOSE("Using FIP\n");
-			io_close(local_image_handle);
+	/*
+	 * See if a Firmware Image Package is available. The FIP device
+	 * (and its backend session) is only re-initialized when the FIP
+	 * source changes, not for every image.
+	 */
+	if (fip_dev_select != fip_select) {
+		fip_dev_select = FIP_SELECT_NONE;
+		result = io_dev_init(fip_dev_handle, (uintptr_t)FIP_IMAGE_ID);
+		if (result != 0) {
+			return result;
 		}
+		fip_dev_select = fip_select;
+	}
+
+	result = io_open(fip_dev_handle, spec, &local_image_handle);
+	if (result == 0) {
+		VERBOSE("Using FIP\n");
+		io_close(local_image_handle);
 	}
 	return result;
 }
@@ -599,16 +629,21 @@ static int check_mtd(const uintptr_t spec)
 	return result;
 }
 
+/*
+ * The FIP location is looked up when the FIP device probes its backend,
+ * as a lazy partition table load must not run while the FIP device
+ * holds the backend open.
+ */
 static int check_mmc_fip(const uintptr_t spec)
 {
-	if (fip_spec_valid)
+	if (lan969x_get_fip_addr(fip_select))
 		return check_mmc(spec);
 	return -EINVAL;
 }
 
 static int check_mtd_fip(const uintptr_t spec)
 {
-	if (fip_spec_valid)
+	if (lan969x_get_fip_addr(fip_select))
 		return check_mtd(spec);
 	return -EINVAL;
 }
@@ -695,8 +730,6 @@ int bl1_plat_handle_pre_image_load(unsigned int image_id)
 		FIP_SELECT_RAM_FIP :
 		FIP_SELECT_DEFAULT;
 
-	fip_spec_valid = lan969x_get_fip_addr(fip_select);
-
 	return 0;
 }
 #elif defined(IMAGE_BL2)
@@ -710,8 +743,6 @@ int bl2_plat_handle_pre_image_load(unsigned int image_id)
 		fip_select = FIP_SELECT_NOR_NT_FIP1;
 	}
 #endif
-	fip_spec_valid = lan969x_get_fip_addr(fip_select);
-
 	return 0;
 }
 #endif
@@ -752,29 +783,24 @@ int plat_try_next_boot_source(void)
 #if defined(IMAGE_BL1)
 	if (fip_select == FIP_SELECT_RAM_FIP) {
 		fip_select = FIP_SELECT_DEFAULT;
-		fip_spec_valid = lan969x_get_fip_addr(fip_select);
 		return 1;	/* Try again */
 	}
 #endif
 	if (fip_select == FIP_SELECT_DEFAULT) {
 		fip_select = FIP_SELECT_FALLBACK;
-		fip_spec_valid = lan969x_get_fip_addr(fip_select);
 		return 1;	/* Try again */
 	}
 	if (fip_select == FIP_SELECT_FALLBACK) {
 		fip_select = FIP_SELECT_RAW;
-		fip_spec_valid = lan969x_get_fip_addr(fip_select);
 		return 1;	/* Try again */
 	}
 #if defined(IMAGE_BL2) && defined(LAN969X_LMSTAX)
 	if (fip_select == FIP_SELECT_RAW) {
 		fip_select = FIP_SELECT_NOR_NT_FIP1;
-		fip_spec_valid = lan969x_get_fip_addr(fip_select);
 		return 1;	/* Try again */
 	}
 	if (fip_select == FIP_SELECT_NOR_NT_FIP1) {
 		fip_select = FIP_SELECT_NOR_NT_FIP2;
-		fip_spec_valid = lan969x_get_fip_addr(fip_select);
 		return 1;	/* Try again */
 	}
 #endif
@@ -831,3 +857,22 @@ size_t lan966x_get_boot_offset(void)
 {
 	return fip_block_spec.offset;
 }
+
+#if defined(IMAGE_BL2)
+int plat_load_hash_start(unsigned int image_id, uintptr_t dev_handle,
+			 uintptr_t image_base, size_t image_size)
+{
+	/* Any previous streamed hash is stale now */
+	sha_load_invalidate();
+
+	/* Encrypted images are read in one go by io_encrypted */
+	if (dev_handle == enc_dev_handle)
+		return -ENOTSUP;
+
+	/* The QSPI read pipeline already hashes the data */
+	if (lan966x_get_boot_source() == BOOT_SOURCE_QSPI)
+		return -ENOTSUP;
+
+	return sha_load_start((void *) image_base, image_size);
+}
+#endif
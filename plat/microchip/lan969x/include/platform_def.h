@@ -40,6 +40,13 @@
 #define MAX_IO_BLOCK_DEVICES		U(2)
 /* QSPI NOR */
 #define MAX_IO_MTD_DEVICES		U(1)
+/* FIP ToC entries indexed in SRAM */
+#define FIP_TOC_INDEX_ENTRIES		U(24)
+
+#if defined(IMAGE_BL2)
+/* io_block LRU cache for partial block reads */
+#define IO_BLOCK_CACHE_ENTRIES		U(4)
+#endif
 
 #define MMC_BUF_SIZE			U(512 * 16)
 
@@ -27,6 +27,9 @@
 static uintptr_t uniphier_mem_base = UNIPHIER_MEM_BASE;
 static unsigned int uniphier_soc = UNIPHIER_SOC_UNKNOWN;
 static int uniphier_bl2_kick_scp;
+#ifdef UNIPHIER_DECOMPRESS_GZIP
+static int uniphier_decompress_pending;
+#endif
 
 void bl2_el3_early_platform_setup(u_register_t x0, u_register_t x1,
 				  u_register_t x2, u_register_t x3)
@@ -121,6 +124,7 @@ void bl2_plat_preload_setup(void)
 		plat_error_handler(ret);
 
 	image_decompress_init(buf_base, UNIPHIER_IMAGE_BUF_SIZE, gunzip);
+	image_decompress_init_stream(gunzip_stream);
 #endif
 
 	uniphier_init_image_descs(uniphier_mem_base);
@@ -141,7 +145,16 @@ int bl2_plat_handle_pre_image_load(unsigned int image_id)
 		return ret;
 
 #ifdef UNIPHIER_DECOMPRESS_GZIP
-	image_decompress_prepare(image_info);
+	/*
+	 * Without TBB or measured boot, the image is inflated while it is
+	 * read, so it is not limited by the size of the temporary buffer.
+	 * This sets IMAGE_ATTRIB_SKIP_LOADING, so remember that it is to be
+	 * decompressed.
+	 */
+	uniphier_decompress_pending =
+		!(image_info->h.attr & IMAGE_ATTRIB_SKIP_LOADING);
+	if (uniphier_decompress_pending)
+		image_decompress_prepare_stream(image_id, image_info);
 #endif
 	return 0;
 }
@@ -152,8 +165,9 @@ int bl2_plat_handle_post_image_load(unsigned int image_id)
 #ifdef UNIPHIER_DECOMPRESS_GZIP
 	int ret;
 
-	if (!(image_info->h.attr & IMAGE_ATTRIB_SKIP_LOADING)) {
-		ret = image_decompress(uniphier_get_image_info(image_id));
+	if (uniphier_decompress_pending) {
+		uniphier_decompress_pending = 0;
+		ret = image_decompress(image_info);
 		if (ret)
 			return ret;
 	}
@@ -189,6 +189,9 @@ enum ddr_type {
 /* Define maximum page size for NAND devices */
 #define PLATFORM_MTD_MAX_PAGE_SIZE	U(0x1000)
 
+/* Define maximum number of blocks tracked in the NAND bad block table */
+#define PLATFORM_MTD_MAX_BLOCKS		U(4096)
+
 /* Define location for the MTD scratch buffer */
 #if STM32MP13
 #define STM32MP_MTD_BUFFER		(SRAM1_BASE + \
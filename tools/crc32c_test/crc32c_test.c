@@ -0,0 +1,141 @@
+/*
+ * Copyright (C) 2026 Microchip Technology Inc. and its subsidiaries.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/*
+ * Host cross-check of the Crc32c() implementations in
+ * plat/microchip/common/lan966x_crc32.c, which the Makefile builds
+ * unmodified under a different name for each:
+ *
+ * - crc32c_byte: one table lookup per byte, as used by BL1;
+ * - crc32c_slice: slicing-by-8, as used by the other ARMv7 images;
+ * - crc32c_hw: the ARMv8 CRC32C instructions, on AArch64 hosts only.
+ *
+ * Each is checked against a bitwise reference for all lengths up to
+ * MAX_LEN at every start offset up to MAX_ALIGN, and when the CRC of a
+ * buffer is accumulated over several calls, as the bootstrap protocol
+ * does with its header and payload.
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+uint32_t crc32c_byte(uint32_t crc, const void *data, size_t size);
+uint32_t crc32c_slice(uint32_t crc, const void *data, size_t size);
+#ifdef CRC32C_HW
+uint32_t crc32c_hw(uint32_t crc, const void *data, size_t size);
+#endif
+
+/* Reflected Castagnoli polynomial 0x1EDC6F41 */
+#define CRC32C_POLY		0x82F63B78U
+/* CRC32C of the ASCII string "123456789" */
+#define CRC32C_CHECK		0xE3069283U
+
+#define MAX_LEN			1024U
+#define MAX_ALIGN		16U
+
+#define MAX_REPORTS		10U
+
+static const struct {
+	const char *name;
+	uint32_t (*crc)(uint32_t crc, const void *data, size_t size);
+} impls[] = {
+	{ "byte", crc32c_byte },
+	{ "slice", crc32c_slice },
+#ifdef CRC32C_HW
+	{ "hw", crc32c_hw },
+#endif
+};
+
+static uint8_t buf[MAX_ALIGN + MAX_LEN] __attribute__((aligned(16)));
+
+static unsigned long checks;
+static unsigned long failures;
+
+#define CHECK(cond, ...)						\
+	do {								\
+		checks++;						\
+		if (!(cond)) {						\
+			if (failures++ < MAX_REPORTS) {			\
+				printf("FAIL: " __VA_ARGS__);		\
+			}						\
+		}							\
+	} while (0)
+
+static uint32_t ref_crc32c(uint32_t crc, const uint8_t *data, size_t size)
+{
+	unsigned int bit;
+	size_t i;
+
+	crc = ~crc;
+	for (i = 0U; i < size; i++) {
+		crc ^= data[i];
+		for (bit = 0U; bit < 8U; bit++) {
+			crc = (crc >> 1) ^ ((crc & 1U) ? CRC32C_POLY : 0U);
+		}
+	}
+
+	return ~crc;
+}
+
+static void test_impl(unsigned int n)
+{
+	const char *check = "123456789";
+	unsigned int al;
+	size_t len, split;
+	uint32_t exp, ret;
+
+	ret = impls[n].crc(0U, check, strlen(check));
+	CHECK(ret == CRC32C_CHECK, "%s: check value 0x%08X, expected 0x%08X\n",
+	      impls[n].name, ret, CRC32C_CHECK);
+
+	for (al = 0U; al < MAX_ALIGN; al++) {
+		for (len = 0U; len <= MAX_LEN; len++) {
+			exp = ref_crc32c(0U, buf + al, len);
+			ret = impls[n].crc(0U, buf + al, len);
+			CHECK(ret == exp, "%s: len=%zu +%u: 0x%08X, expected 0x%08X\n",
+			      impls[n].name, len, al, ret, exp);
+		}
+	}
+
+	/* Accumulated over two calls, the second one starting misaligned */
+	for (len = 0U; len <= 64U; len++) {
+		exp = ref_crc32c(0U, buf, len);
+		for (split = 0U; split <= len; split++) {
+			ret = impls[n].crc(0U, buf, split);
+			ret = impls[n].crc(ret, buf + split, len - split);
+			CHECK(ret == exp, "%s: len=%zu split at %zu: 0x%08X, expected 0x%08X\n",
+			      impls[n].name, len, split, ret, exp);
+		}
+	}
+}
+
+int main(void)
+{
+	unsigned long total_failures = 0U;
+	uint32_t state = 0x12345678U;
+	unsigned int i;
+
+	for (i = 0U; i < sizeof(buf); i++) {
+		/* xorshift32 */
+		state ^= state << 13;
+		state ^= state >> 17;
+		state ^= state << 5;
+		buf[i] = (uint8_t)state;
+	}
+
+	for (i = 0U; i < sizeof(impls) / sizeof(impls[0]); i++) {
+		test_impl(i);
+		printf("%-6s %lu checks, %lu failed\n", impls[i].name, checks,
+		       failures);
+		total_failures += failures;
+		checks = failures = 0U;
+	}
+
+	return (total_failures == 0U) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -19,10 +19,12 @@
 #include "fiptool.h"
 #include "tbbr_config.h"
 #include "firmware_encrypted.h"
+#include "lz4.h"
 
 #define OPT_TOC_ENTRY 0
 #define OPT_PLAT_TOC_FLAGS 1
 #define OPT_ALIGN 2
+#define OPT_LZ4 3
 
 static int info_cmd(int argc, char *argv[]);
 static void info_usage(int);
@@ -620,6 +622,35 @@ static int pack_images(const char *filename, uint64_t toc_flags, unsigned long a
 	return 0;
 }
 
+static void set_image_desc_lz4(const char *opt)
+{
+	image_desc_t *desc;
+
+	desc = lookup_image_desc_from_opt(opt);
+	if (desc == NULL)
+		log_errx("Invalid image for --lz4: %s", opt);
+	desc->lz4 = 1;
+}
+
+/* Replace the image payload with an LZ4 frame of it */
+static void compress_image_lz4(image_t *image, const char *name)
+{
+	void *buf;
+	size_t len;
+
+	buf = lz4_compress_frame(image->buffer, image->toc_e.size, &len);
+	if (buf == NULL)
+		log_errx("Failed to compress %s", name);
+
+	if (verbose)
+		log_dbgx("Compressed %s: %llu -> %zu bytes", name,
+		    (unsigned long long)image->toc_e.size, len);
+
+	free(image->buffer);
+	image->buffer = buf;
+	image->toc_e.size = len;
+}
+
 /*
  * This function is shared between the create and update subcommands.
  * The difference between the two subcommands is that when the FIP file
@@ -640,6 +671,8 @@ static void update_fip(void)
 
 		image = read_image_from_file(&desc->uuid,
 		    desc->action_arg);
+		if (desc->lz4 && image->toc_e.size != 0ULL)
+			compress_image_lz4(image, desc->cmdline_name);
 		if (desc->image != NULL) {
 			if (verbose) {
 				log_dbgx("Replacing %s with %s",
@@ -718,6 +751,7 @@ static int create_cmd(int argc, char *argv[])
 	    OPT_PLAT_TOC_FLAGS);
 	opts = add_opt(opts, &nr_opts, "align", required_argument, OPT_ALIGN);
 	opts = add_opt(opts, &nr_opts, "blob", required_argument, 'b');
+	opts = add_opt(opts, &nr_opts, "lz4", required_argument, OPT_LZ4);
 	opts = add_opt(opts, &nr_opts, NULL, 0, 0);
 
 	while (1) {
@@ -741,6 +775,9 @@ static int create_cmd(int argc, char *argv[])
 		case OPT_ALIGN:
 			align = get_image_align(optarg);
 			break;
+		case OPT_LZ4:
+			set_image_desc_lz4(optarg);
+			break;
 		case 'b': {
 			char name[_UUID_STR_LEN + 1];
 			char filename[PATH_MAX] = { 0 };
@@ -789,6 +826,7 @@ static void create_usage(int exit_status)
 	printf("Options:\n");
 	printf("  --align <value>\t\tEach image is aligned to <value> (default: 1).\n");
 	printf("  --blob uuid=...,file=...\tAdd an image with the given UUID pointed to by file.\n");
+	printf("  --lz4 <image>\t\t\tCompress the given image (e.g. nt-fw) as an LZ4 frame.\n");
 	printf("  --plat-toc-flags <value>\t16-bit platform specific flag field occupying bits 32-47 in 64-bit ToC header.\n");
 	printf("\n");
 	printf("Specific images are packed with the following options:\n");
@@ -820,6 +858,7 @@ static int update_cmd(int argc, char *argv[])
 	opts = fill_common_opts(opts, &nr_opts, required_argument);
 	opts = add_opt(opts, &nr_opts, "align", required_argument, OPT_ALIGN);
 	opts = add_opt(opts, &nr_opts, "blob", required_argument, 'b');
+	opts = add_opt(opts, &nr_opts, "lz4", required_argument, OPT_LZ4);
 	opts = add_opt(opts, &nr_opts, "out", required_argument, 'o');
 	opts = add_opt(opts, &nr_opts, "plat-toc-flags", required_argument,
 	    OPT_PLAT_TOC_FLAGS);
@@ -869,6 +908,9 @@ static int update_cmd(int argc, char *argv[])
 		case OPT_ALIGN:
 			align = get_image_align(optarg);
 			break;
+		case OPT_LZ4:
+			set_image_desc_lz4(optarg);
+			break;
 		case 'o':
 			snprintf(outfile, sizeof(outfile), "%s", optarg);
 			break;
@@ -908,6 +950,7 @@ static void update_usage(int exit_status)
 	printf("Options:\n");
 	printf("  --align <value>\t\tEach image is aligned to <value> (default: 1).\n");
 	printf("  --blob uuid=...,file=...\tAdd or update an image with the given UUID pointed to by file.\n");
+	printf("  --lz4 <image>\t\t\tCompress the given image (e.g. nt-fw) as an LZ4 frame.\n");
 	printf("  --out FIP_FILENAME\t\tSet an alternative output FIP file.\n");
 	printf("  --plat-toc-flags <value>\t16-bit platform specific flag field occupying bits 32-47 in 64-bit ToC header.\n");
 	printf("\n");
@@ -36,6 +36,7 @@ typedef struct image_desc {
 	char              *cmdline_name;
 	int                action;
 	char              *action_arg;
+	int                lz4;
 	struct image      *image;
 	struct image_desc *next;
 } image_desc_t;
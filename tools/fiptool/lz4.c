@@ -0,0 +1,235 @@
+/*
+ * Copyright (C) 2026 Microchip Technology Inc. and its subsidiaries.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/*
+ * Minimal LZ4 frame compressor (greedy, single hash table), producing
+ * frames that can be decoded by lib/lz4 as well as by the lz4 utility.
+ */
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "lz4.h"
+
+#define LZ4_FRAME_MAGIC		0x184D2204U
+#define LZ4F_FLG		0x4CU	/* v01, linked blocks, size, checksum */
+#define LZ4F_BD			0x70U	/* 4 MiB blocks */
+#define LZ4F_BLOCK_SIZE		(4U * 1024U * 1024U)
+#define LZ4F_BLOCK_UNCOMPRESSED	0x80000000U
+
+#define LZ4_MIN_MATCH		4U
+#define LZ4_MAX_OFFSET		65535U
+#define LZ4_LAST_LITERALS	5U	/* Block ends with at least 5 literals */
+#define LZ4_MF_LIMIT		12U	/* No match starts in the last 12 bytes */
+#define LZ4_HASH_BITS		16U
+
+#define XXH_PRIME32_1		0x9E3779B1U
+#define XXH_PRIME32_2		0x85EBCA77U
+#define XXH_PRIME32_3		0xC2B2AE3DU
+#define XXH_PRIME32_4		0x27D4EB2FU
+#define XXH_PRIME32_5		0x165667B1U
+
+static uint32_t get_le32(const uint8_t *p)
+{
+	return (uint32_t)p[0] | ((uint32_t)p[1] << 8) |
+		((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static uint8_t *put_le32(uint8_t *p, uint32_t v)
+{
+	p[0] = v & 0xFF;
+	p[1] = (v >> 8) & 0xFF;
+	p[2] = (v >> 16) & 0xFF;
+	p[3] = (v >> 24) & 0xFF;
+	return p + 4;
+}
+
+static uint32_t rotl32(uint32_t x, unsigned int r)
+{
+	return (x << r) | (x >> (32U - r));
+}
+
+static uint32_t xxh32_round(uint32_t acc, uint32_t input)
+{
+	acc += input * XXH_PRIME32_2;
+	acc = rotl32(acc, 13U);
+	return acc * XXH_PRIME32_1;
+}
+
+static uint32_t xxh32(const uint8_t *p, size_t len, uint32_t seed)
+{
+	const uint8_t *end = p + len;
+	uint32_t h;
+
+	if (len >= 16) {
+		uint32_t v1 = seed + XXH_PRIME32_1 + XXH_PRIME32_2;
+		uint32_t v2 = seed + XXH_PRIME32_2;
+		uint32_t v3 = seed;
+		uint32_t v4 = seed - XXH_PRIME32_1;
+
+		do {
+			v1 = xxh32_round(v1, get_le32(p));
+			v2 = xxh32_round(v2, get_le32(p + 4));
+			v3 = xxh32_round(v3, get_le32(p + 8));
+			v4 = xxh32_round(v4, get_le32(p + 12));
+			p += 16;
+		} while (p <= end - 16);
+
+		h = rotl32(v1, 1U) + rotl32(v2, 7U) +
+			rotl32(v3, 12U) + rotl32(v4, 18U);
+	} else {
+		h = seed + XXH_PRIME32_5;
+	}
+
+	h += (uint32_t)len;
+
+	while (p + 4 <= end) {
+		h += get_le32(p) * XXH_PRIME32_3;
+		h = rotl32(h, 17U) * XXH_PRIME32_4;
+		p += 4;
+	}
+
+	while (p < end) {
+		h += (*p++) * XXH_PRIME32_5;
+		h = rotl32(h, 11U) * XXH_PRIME32_1;
+	}
+
+	h ^= h >> 15;
+	h *= XXH_PRIME32_2;
+	h ^= h >> 13;
+	h *= XXH_PRIME32_3;
+	h ^= h >> 16;
+
+	return h;
+}
+
+static uint8_t *put_len(uint8_t *op, size_t len)
+{
+	for (; len >= 255; len -= 255)
+		*op++ = 255;
+	*op++ = (uint8_t)len;
+	return op;
+}
+
+/* Emit one sequence: literals followed by an optional match */
+static uint8_t *put_sequence(uint8_t *op, const uint8_t *lit, size_t lit_len,
+    size_t offset, size_t match_len)
+{
+	uint8_t *token = op++;
+	size_t ml = match_len ? match_len - LZ4_MIN_MATCH : 0;
+
+	*token = (uint8_t)(((lit_len < 15 ? lit_len : 15) << 4) |
+	    (ml < 15 ? ml : 15));
+	if (lit_len >= 15)
+		op = put_len(op, lit_len - 15);
+	memcpy(op, lit, lit_len);
+	op += lit_len;
+
+	if (match_len != 0) {
+		*op++ = offset & 0xFF;
+		*op++ = (offset >> 8) & 0xFF;
+		if (ml >= 15)
+			op = put_len(op, ml - 15);
+	}
+
+	return op;
+}
+
+/*
+ * Compress the block [start, end) of src. Matches may reach back into
+ * previous blocks (linked blocks). Returns the end of the output.
+ */
+static uint8_t *compress_block(const uint8_t *src, const uint8_t *start,
+    const uint8_t *end, int32_t *table, uint8_t *op)
+{
+	const uint8_t *ip = start, *anchor = start;
+	const uint8_t *mflimit = end - LZ4_MF_LIMIT;
+	const uint8_t *matchlimit = end - LZ4_LAST_LITERALS;
+
+	if (end - start < LZ4_MF_LIMIT + 1)
+		goto last_literals;
+
+	while (ip < mflimit) {
+		uint32_t seq = get_le32(ip);
+		uint32_t h = (seq * 2654435761U) >> (32 - LZ4_HASH_BITS);
+		int32_t ref = table[h];
+		const uint8_t *match;
+		size_t len;
+
+		table[h] = (int32_t)(ip - src);
+		if (ref < 0 || (size_t)((ip - src) - ref) > LZ4_MAX_OFFSET ||
+		    get_le32(src + ref) != seq) {
+			ip++;
+			continue;
+		}
+
+		match = src + ref;
+		len = LZ4_MIN_MATCH;
+		while (ip + len < matchlimit && match[len] == ip[len])
+			len++;
+
+		op = put_sequence(op, anchor, ip - anchor, ip - match, len);
+		ip += len;
+		anchor = ip;
+	}
+
+last_literals:
+	return put_sequence(op, anchor, end - anchor, 0, 0);
+}
+
+void *lz4_compress_frame(const void *src, size_t len, size_t *out_len)
+{
+	const uint8_t *in = src;
+	uint8_t *out, *op, *desc, *tmp, *tend;
+	int32_t *table;
+	size_t pos, blen;
+
+	/* Worst case: incompressible blocks are stored as-is */
+	out = malloc(len + (len / LZ4F_BLOCK_SIZE + 1) * 8 + 32);
+	/* Room for one compressed block before it is known to be smaller */
+	tmp = malloc(LZ4F_BLOCK_SIZE + LZ4F_BLOCK_SIZE / 255 + 16);
+	table = malloc(sizeof(*table) << LZ4_HASH_BITS);
+	if (out == NULL || tmp == NULL || table == NULL) {
+		free(out);
+		free(tmp);
+		free(table);
+		return NULL;
+	}
+	memset(table, 0xFF, sizeof(*table) << LZ4_HASH_BITS);
+
+	op = put_le32(out, LZ4_FRAME_MAGIC);
+	desc = op;
+	*op++ = LZ4F_FLG;
+	*op++ = LZ4F_BD;
+	op = put_le32(op, (uint32_t)len);
+	op = put_le32(op, (uint32_t)((uint64_t)len >> 32));
+	*op = (xxh32(desc, op - desc, 0) >> 8) & 0xFF;
+	op++;
+
+	for (pos = 0; pos < len; pos += blen) {
+		blen = len - pos < LZ4F_BLOCK_SIZE ? len - pos : LZ4F_BLOCK_SIZE;
+
+		tend = compress_block(in, in + pos, in + pos + blen, table, tmp);
+		if ((size_t)(tend - tmp) < blen) {
+			op = put_le32(op, (uint32_t)(tend - tmp));
+			memcpy(op, tmp, tend - tmp);
+			op += tend - tmp;
+		} else {
+			op = put_le32(op, (uint32_t)blen | LZ4F_BLOCK_UNCOMPRESSED);
+			memcpy(op, in + pos, blen);
+			op += blen;
+		}
+	}
+
+	op = put_le32(op, 0);			/* EndMark */
+	op = put_le32(op, xxh32(in, len, 0));	/* Content checksum */
+
+	free(tmp);
+	free(table);
+	*out_len = op - out;
+	return out;
+}
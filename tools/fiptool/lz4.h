@@ -0,0 +1,14 @@
+/*
+ * Copyright (C) 2026 Microchip Technology Inc. and its subsidiaries.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef LZ4_H
+#define LZ4_H
+
+#include <stddef.h>
+
+void *lz4_compress_frame(const void *src, size_t len, size_t *out_len);
+
+#endif /* LZ4_H */
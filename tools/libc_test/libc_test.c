@@ -0,0 +1,604 @@
+/*
+ * Copyright (C) 2026 Microchip Technology Inc. and its subsidiaries.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/*
+ * Host test of the AArch64 assembly routines in lib/libc/aarch64.
+ *
+ * The routines are assembled with a tf_ prefix so that they do not clash
+ * with the host C library, and are checked against byte-wise reference
+ * versions. Every size, source/destination alignment and overlap that
+ * takes a different path through the assembly is tried. The comparisons
+ * check the sign of the result both ways round, and every routine that
+ * reads its arguments is also given objects ending at an unmapped page.
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+void *tf_memcpy(void *dst, const void *src, size_t count);
+void *tf_memmove(void *dst, const void *src, size_t count);
+size_t tf_strlen(const char *s);
+int tf_strcmp(const char *s1, const char *s2);
+int tf_strncmp(const char *s1, const char *s2, size_t n);
+int tf_memcmp(const void *s1, const void *s2, size_t len);
+void *tf_memchr(const void *src, int c, size_t len);
+
+/* All sizes up to this one are tried, they cover every tail and loop */
+#define MAX_SMALL_SIZE		200U
+/* Alignment offsets tried, relative to a 16-byte aligned buffer */
+#define MAX_ALIGN		16U
+/* Bytes checked on each side of the destination for stray writes */
+#define GUARD			32U
+#define GUARD_BYTE		0xa5U
+
+#define MAX_SIZE		4097U
+#define BUF_SIZE		(GUARD + MAX_ALIGN + MAX_SIZE + GUARD)
+/*
+ * memmove moves data within a single buffer, by up to MAX_SIZE + 1 bytes
+ * in either direction.
+ */
+#define MAX_DELTA		(MAX_SIZE + 1U)
+#define MOVE_BUF_SIZE		(GUARD + MAX_DELTA + MAX_ALIGN + MAX_DELTA + \
+				 MAX_SIZE + GUARD)
+
+/* Strings and objects of all sizes up to this one are compared/searched */
+#define MAX_STR_SIZE		80U
+#define STR_BUF_SIZE		(GUARD + MAX_ALIGN + MAX_STR_SIZE + 1U + GUARD)
+
+#define MAX_REPORTS		10U
+
+/* Larger sizes, around multiples of the 64-byte block */
+static const size_t large_sizes[] = {
+	255, 256, 257, 511, 512, 513, 1023, 1024, 1025, 4095, 4096, 4097
+};
+
+static uint8_t src_buf[BUF_SIZE] __attribute__((aligned(16)));
+static uint8_t dst_buf[BUF_SIZE] __attribute__((aligned(16)));
+static uint8_t exp_buf[BUF_SIZE] __attribute__((aligned(16)));
+
+static uint8_t move_buf[MOVE_BUF_SIZE] __attribute__((aligned(16)));
+static uint8_t move_orig[MOVE_BUF_SIZE] __attribute__((aligned(16)));
+static uint8_t move_exp[MOVE_BUF_SIZE] __attribute__((aligned(16)));
+
+static uint8_t str_buf[2][STR_BUF_SIZE] __attribute__((aligned(16)));
+
+/*
+ * Pages followed by an inaccessible one: an object ending at the end of
+ * such a page faults if a routine reads past it.
+ */
+static uint8_t *tail_page[2];
+static size_t page_size;
+
+/* Byte values around the sign bit and the terminating NUL */
+static const uint8_t edge_bytes[] = { 0x00, 0x01, 0x7f, 0x80, 0xfe, 0xff };
+#define NUM_EDGE_BYTES		(sizeof(edge_bytes) / sizeof(edge_bytes[0]))
+
+static unsigned long checks;
+static unsigned long failures;
+
+#define CHECK(cond, ...)						\
+	do {								\
+		checks++;						\
+		if (!(cond)) {						\
+			if (failures++ < MAX_REPORTS) {			\
+				printf("FAIL: " __VA_ARGS__);		\
+			}						\
+		}							\
+	} while (0)
+
+/* Fill a buffer with non-zero bytes that differ between calls */
+static void fill(uint8_t *buf, size_t len)
+{
+	static uint32_t state = 0x12345678U;
+	size_t i;
+
+	for (i = 0U; i < len; i++) {
+		/* xorshift32 */
+		state ^= state << 13;
+		state ^= state >> 17;
+		state ^= state << 5;
+		buf[i] = (uint8_t)((state % 255U) + 1U);
+	}
+}
+
+/* Fill a buffer with bytes of any value, including zero */
+static void fill_any(uint8_t *buf, size_t len)
+{
+	size_t i;
+
+	fill(buf, len);
+	for (i = 0U; i < len; i++) {
+		buf[i]--;
+	}
+}
+
+static int sign(int v)
+{
+	return (v > 0) - (v < 0);
+}
+
+static void ref_memcpy(uint8_t *dst, const uint8_t *src, size_t n)
+{
+	size_t i;
+
+	for (i = 0U; i < n; i++) {
+		dst[i] = src[i];
+	}
+}
+
+static void ref_memmove(uint8_t *dst, const uint8_t *src, size_t n)
+{
+	size_t i;
+
+	if (dst < src) {
+		for (i = 0U; i < n; i++) {
+			dst[i] = src[i];
+		}
+	} else {
+		for (i = n; i > 0U; i--) {
+			dst[i - 1U] = src[i - 1U];
+		}
+	}
+}
+
+/* Call fn for all small sizes, then for the large ones */
+static void for_each_size(void (*fn)(size_t n))
+{
+	size_t n;
+	unsigned int i;
+
+	for (n = 0U; n <= MAX_SMALL_SIZE; n++) {
+		fn(n);
+	}
+	for (i = 0U; i < sizeof(large_sizes) / sizeof(large_sizes[0]); i++) {
+		fn(large_sizes[i]);
+	}
+}
+
+static void test_memcpy_size(size_t n)
+{
+	/* Area possibly written: the largest alignment plus guards */
+	size_t span = GUARD + MAX_ALIGN + n + GUARD;
+	unsigned int s_al, d_al;
+	uint8_t *src, *dst;
+	void *ret;
+
+	for (s_al = 0U; s_al < MAX_ALIGN; s_al++) {
+		fill(src_buf, span);
+		src = src_buf + GUARD + s_al;
+
+		for (d_al = 0U; d_al < MAX_ALIGN; d_al++) {
+			dst = dst_buf + GUARD + d_al;
+
+			memset(dst_buf, GUARD_BYTE, span);
+			memset(exp_buf, GUARD_BYTE, span);
+			ref_memcpy(exp_buf + GUARD + d_al, src, n);
+
+			ret = tf_memcpy(dst, src, n);
+
+			CHECK(ret == dst, "memcpy n=%zu src+%u dst+%u: returned %p, expected %p\n",
+			      n, s_al, d_al, ret, (void *)dst);
+			CHECK(memcmp(dst_buf, exp_buf, span) == 0,
+			      "memcpy n=%zu src+%u dst+%u: wrong data\n",
+			      n, s_al, d_al);
+		}
+	}
+}
+
+/* Test one memmove of n bytes, dst being src + delta */
+static void test_memmove_one(size_t n, unsigned int s_al, long delta)
+{
+	/* Source far enough from both ends for the largest delta */
+	size_t s_off = GUARD + MAX_DELTA + s_al;
+	size_t d_off = (size_t)((long)s_off + delta);
+	size_t lo = ((d_off < s_off) ? d_off : s_off) - GUARD;
+	size_t span = ((d_off > s_off) ? d_off : s_off) + n + GUARD - lo;
+	void *ret;
+
+	memcpy(move_buf + lo, move_orig + lo, span);
+	memcpy(move_exp + lo, move_orig + lo, span);
+	ref_memmove(move_exp + d_off, move_exp + s_off, n);
+
+	ret = tf_memmove(move_buf + d_off, move_buf + s_off, n);
+
+	CHECK(ret == move_buf + d_off,
+	      "memmove n=%zu src+%u delta=%ld: returned %p, expected %p\n",
+	      n, s_al, delta, ret, (void *)(move_buf + d_off));
+	CHECK(memcmp(move_buf + lo, move_exp + lo, span) == 0,
+	      "memmove n=%zu src+%u delta=%ld: wrong data\n", n, s_al, delta);
+}
+
+static void test_memmove_size(size_t n)
+{
+	/* Overlaps by a few bytes, and the boundaries of the overlap */
+	long near = (long)MAX_ALIGN + 8;
+	long deltas[] = {
+		-(long)n - 1, -(long)n, -(long)n + 1, -(long)n / 2,
+		(long)n / 2, (long)n - 1, (long)n, (long)n + 1
+	};
+	unsigned int s_al, i;
+	long delta;
+
+	for (s_al = 0U; s_al < MAX_ALIGN; s_al++) {
+		for (delta = -near; delta <= near; delta++) {
+			test_memmove_one(n, s_al, delta);
+		}
+		for (i = 0U; i < sizeof(deltas) / sizeof(deltas[0]); i++) {
+			if ((deltas[i] < -near) || (deltas[i] > near)) {
+				test_memmove_one(n, s_al, deltas[i]);
+			}
+		}
+	}
+}
+
+static int ref_strncmp(const uint8_t *s1, const uint8_t *s2, size_t n)
+{
+	size_t i;
+
+	for (i = 0U; i < n; i++) {
+		if ((s1[i] != s2[i]) || (s1[i] == 0U)) {
+			return s1[i] - s2[i];
+		}
+	}
+
+	return 0;
+}
+
+static int ref_memcmp(const uint8_t *s1, const uint8_t *s2, size_t len)
+{
+	size_t i;
+
+	for (i = 0U; i < len; i++) {
+		if (s1[i] != s2[i]) {
+			return s1[i] - s2[i];
+		}
+	}
+
+	return 0;
+}
+
+static void setup_tail_pages(void)
+{
+	unsigned int i;
+	uint8_t *p;
+
+	page_size = (size_t)sysconf(_SC_PAGESIZE);
+
+	for (i = 0U; i < 2U; i++) {
+		p = mmap(NULL, 2U * page_size, PROT_READ | PROT_WRITE,
+			 MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+		if ((p == MAP_FAILED) ||
+		    (mprotect(p + page_size, page_size, PROT_NONE) != 0)) {
+			perror("libc_test: tail page");
+			exit(EXIT_FAILURE);
+		}
+		tail_page[i] = p;
+	}
+}
+
+/* Start of len bytes ending at the last accessible byte of a tail page */
+static uint8_t *page_tail(unsigned int i, size_t len)
+{
+	return tail_page[i] + page_size - len;
+}
+
+/* Fill len non-NUL bytes at s and terminate them */
+static void make_str(uint8_t *s, size_t len)
+{
+	fill(s, len);
+	s[len] = 0U;
+}
+
+static void test_strlen_one(const uint8_t *s, size_t len, const char *where)
+{
+	size_t ret = tf_strlen((const char *)s);
+
+	CHECK(ret == len, "strlen %s len=%zu s=%p: returned %zu\n",
+	      where, len, (const void *)s, ret);
+}
+
+static void test_strlen(void)
+{
+	unsigned int al;
+	uint8_t *s;
+	size_t len;
+
+	for (len = 0U; len <= MAX_STR_SIZE; len++) {
+		for (al = 0U; al < MAX_ALIGN; al++) {
+			/* NULs before the string and garbage after it */
+			fill(str_buf[0], STR_BUF_SIZE);
+			memset(str_buf[0], 0, GUARD + al);
+			s = str_buf[0] + GUARD + al;
+			make_str(s, len);
+			test_strlen_one(s, len, "buffer");
+		}
+
+		s = page_tail(0U, len + 1U);
+		memset(tail_page[0], 0, page_size - len - 1U);
+		make_str(s, len);
+		test_strlen_one(s, len, "page tail");
+	}
+}
+
+/* Compare s1 and s2 both ways, with strcmp and with strncmp(n) */
+static void test_strcmp_pair(const uint8_t *s1, const uint8_t *s2, size_t n,
+			     const char *where)
+{
+	int exp = sign(ref_strncmp(s1, s2, SIZE_MAX));
+	int ret;
+
+	ret = sign(tf_strcmp((const char *)s1, (const char *)s2));
+	CHECK(ret == exp, "strcmp %s \"%.8s\" \"%.8s\": sign %d, expected %d\n",
+	      where, (const char *)s1, (const char *)s2, ret, exp);
+	ret = sign(tf_strcmp((const char *)s2, (const char *)s1));
+	CHECK(ret == -exp, "strcmp %s \"%.8s\" \"%.8s\": sign %d, expected %d\n",
+	      where, (const char *)s2, (const char *)s1, ret, -exp);
+
+	exp = sign(ref_strncmp(s1, s2, n));
+	ret = sign(tf_strncmp((const char *)s1, (const char *)s2, n));
+	CHECK(ret == exp, "strncmp %s n=%zu \"%.8s\" \"%.8s\": sign %d, expected %d\n",
+	      where, n, (const char *)s1, (const char *)s2, ret, exp);
+	ret = sign(tf_strncmp((const char *)s2, (const char *)s1, n));
+	CHECK(ret == -exp, "strncmp %s n=%zu \"%.8s\" \"%.8s\": sign %d, expected %d\n",
+	      where, n, (const char *)s2, (const char *)s1, ret, -exp);
+}
+
+/*
+ * Compare s1 of length len with a copy s2 that differs at position p
+ * (p == len makes s2 longer), for all the edge values of that byte.
+ */
+static void test_strcmp_diff(uint8_t *s1, uint8_t *s2, size_t len, size_t p,
+			     const char *where)
+{
+	const size_t n[] = { p, p + 1U, len + 1U, SIZE_MAX };
+	unsigned int i, j;
+
+	for (i = 0U; i < NUM_EDGE_BYTES; i++) {
+		if (edge_bytes[i] == s1[p]) {
+			continue;
+		}
+		memcpy(s2, s1, len + 1U);
+		s2[p] = edge_bytes[i];
+		for (j = 0U; j < sizeof(n) / sizeof(n[0]); j++) {
+			test_strcmp_pair(s1, s2, n[j], where);
+		}
+	}
+}
+
+static void test_strcmp(void)
+{
+	unsigned int a1, a2;
+	uint8_t *s1, *s2;
+	size_t len, p, n;
+
+	for (len = 0U; len <= MAX_STR_SIZE; len++) {
+		for (a1 = 0U; a1 < 8U; a1++) {
+			for (a2 = 0U; a2 < 8U; a2++) {
+				s1 = str_buf[0] + GUARD + a1;
+				s2 = str_buf[1] + GUARD + a2;
+
+				/* Equal strings, different garbage after them */
+				fill(str_buf[0], STR_BUF_SIZE);
+				fill(str_buf[1], STR_BUF_SIZE);
+				make_str(s1, len);
+				memcpy(s2, s1, len + 1U);
+				for (n = 0U; n <= len + 9U; n++) {
+					test_strcmp_pair(s1, s2, n, "buffer");
+				}
+
+				for (p = 0U; p <= len; p++) {
+					test_strcmp_diff(s1, s2, len, p, "buffer");
+				}
+			}
+		}
+
+		/* Both strings end at a page boundary */
+		s1 = page_tail(0U, len + 1U);
+		s2 = page_tail(1U, len + 1U);
+		make_str(s1, len);
+		memcpy(s2, s1, len + 1U);
+		test_strcmp_pair(s1, s2, SIZE_MAX, "page tail");
+		if (len > 0U) {
+			test_strcmp_diff(s1, s2, len, len - 1U, "page tail");
+		}
+	}
+
+	/* n == 0 compares nothing, not even the first characters */
+	CHECK(tf_strncmp("a", "b", 0U) == 0, "strncmp n=0: not equal\n");
+	CHECK(tf_strncmp((const char *)tail_page[0] + page_size,
+			 (const char *)tail_page[1] + page_size, 0U) == 0,
+	      "strncmp n=0: not equal\n");
+}
+
+static void test_memcmp_one(const uint8_t *s1, const uint8_t *s2, size_t len,
+			    const char *where)
+{
+	int exp = sign(ref_memcmp(s1, s2, len));
+	int ret;
+
+	ret = sign(tf_memcmp(s1, s2, len));
+	CHECK(ret == exp, "memcmp %s len=%zu s1=%p s2=%p: sign %d, expected %d\n",
+	      where, len, (const void *)s1, (const void *)s2, ret, exp);
+	ret = sign(tf_memcmp(s2, s1, len));
+	CHECK(ret == -exp, "memcmp %s len=%zu s1=%p s2=%p: sign %d, expected %d\n",
+	      where, len, (const void *)s2, (const void *)s1, ret, -exp);
+}
+
+/* Compare s1 with a copy s2 that differs at position p */
+static void test_memcmp_diff(const uint8_t *s1, uint8_t *s2, size_t len,
+			     size_t p, const char *where)
+{
+	unsigned int i;
+
+	for (i = 0U; i < NUM_EDGE_BYTES; i++) {
+		if (edge_bytes[i] == s1[p]) {
+			continue;
+		}
+		memcpy(s2, s1, len);
+		s2[p] = edge_bytes[i];
+		test_memcmp_one(s1, s2, len, where);
+		/* Only the first difference counts */
+		if (p + 1U < len) {
+			s2[len - 1U] ^= 0xffU;
+			test_memcmp_one(s1, s2, len, where);
+		}
+	}
+}
+
+static void test_memcmp(void)
+{
+	unsigned int a1, a2;
+	uint8_t *s1, *s2;
+	size_t len, p;
+
+	for (len = 0U; len <= MAX_STR_SIZE; len++) {
+		for (a1 = 0U; a1 < 8U; a1++) {
+			for (a2 = 0U; a2 < 8U; a2++) {
+				s1 = str_buf[0] + GUARD + a1;
+				s2 = str_buf[1] + GUARD + a2;
+
+				fill(str_buf[0], STR_BUF_SIZE);
+				fill(str_buf[1], STR_BUF_SIZE);
+				fill_any(s1, len);
+				memcpy(s2, s1, len);
+				test_memcmp_one(s1, s2, len, "buffer");
+
+				for (p = 0U; p < len; p++) {
+					test_memcmp_diff(s1, s2, len, p,
+							 "buffer");
+				}
+			}
+		}
+
+		/* Both objects end at a page boundary */
+		s1 = page_tail(0U, len);
+		s2 = page_tail(1U, len);
+		fill_any(s1, len);
+		memcpy(s2, s1, len);
+		test_memcmp_one(s1, s2, len, "page tail");
+		if (len > 0U) {
+			test_memcmp_diff(s1, s2, len, len - 1U, "page tail");
+		}
+	}
+}
+
+static void test_memchr_one(const uint8_t *s, int c, size_t len,
+			    const uint8_t *exp, const char *where)
+{
+	const void *ret = tf_memchr(s, c, len);
+
+	CHECK(ret == exp, "memchr %s c=%d len=%zu s=%p: returned %p, expected %p\n",
+	      where, c, len, (const void *)s, ret, (const void *)exp);
+}
+
+/* Fill len bytes at s, none of them equal to c */
+static void fill_without(uint8_t *s, size_t len, uint8_t c)
+{
+	size_t i;
+
+	fill_any(s, len);
+	for (i = 0U; i < len; i++) {
+		if (s[i] == c) {
+			s[i] ^= 0x55U;
+		}
+	}
+}
+
+static void test_memchr(void)
+{
+	unsigned int al, i, j;
+	uint8_t *s, c;
+	size_t len, p;
+	int arg[4];
+
+	for (i = 0U; i < NUM_EDGE_BYTES; i++) {
+		c = edge_bytes[i];
+		/* Only the low byte of c counts */
+		arg[0] = c;
+		arg[1] = c + 0x100;
+		arg[2] = c - 0x100;
+		arg[3] = c | 0x7fffff00;
+
+		for (len = 0U; len <= MAX_STR_SIZE; len++) {
+			for (al = 0U; al < MAX_ALIGN; al++) {
+				/* Matches just before and just after */
+				memset(str_buf[0], c, STR_BUF_SIZE);
+				s = str_buf[0] + GUARD + al;
+				fill_without(s, len, c);
+				for (j = 0U; j < 4U; j++) {
+					test_memchr_one(s, arg[j], len, NULL,
+							"buffer");
+				}
+
+				for (p = 0U; p < len; p++) {
+					s[p] = c;
+					for (j = 0U; j < 4U; j++) {
+						test_memchr_one(s, arg[j], len,
+								s + p, "buffer");
+					}
+					s[p] = c ^ 0x55U;
+				}
+
+				/* The search may go beyond the top of memory */
+				if (len > 0U) {
+					s[len - 1U] = c;
+					test_memchr_one(s, c, SIZE_MAX,
+							s + len - 1U, "buffer");
+				}
+			}
+
+			/* Object ends at a page boundary */
+			s = page_tail(0U, len);
+			fill_without(s, len, c);
+			test_memchr_one(s, c, len, NULL, "page tail");
+			if (len > 0U) {
+				s[len - 1U] = c;
+				test_memchr_one(s, c, len, s + len - 1U,
+						"page tail");
+			}
+		}
+	}
+}
+
+static unsigned long total_failures;
+
+static void report(const char *name)
+{
+	printf("%-8s %lu checks, %lu failed\n", name, checks, failures);
+	total_failures += failures;
+	checks = failures = 0U;
+}
+
+int main(void)
+{
+	for_each_size(test_memcpy_size);
+	report("memcpy");
+
+	fill(move_orig, sizeof(move_orig));
+	for_each_size(test_memmove_size);
+	report("memmove");
+
+	setup_tail_pages();
+
+	test_strlen();
+	report("strlen");
+
+	test_strcmp();
+	report("strcmp");
+
+	test_memcmp();
+	report("memcmp");
+
+	test_memchr();
+	report("memchr");
+
+	return (total_failures == 0U) ? EXIT_SUCCESS : EXIT_FAILURE;
+}